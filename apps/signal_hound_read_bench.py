@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+#
+# Copyright 2025 Signal Hound.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+'''
+Per-call read cost of the Signal Hound sources across request sizes.
+
+A source block reads a generated recording through the unpaced replay device,
+which stands in for the vendor API, once for every request size. Each run
+fixes the request size with set_read_latency() and set_max_noutput_items(),
+then times a set number of samples into a null sink. The time per sample is
+fitted as
+
+    per sample + per call / request size
+
+which splits the fixed cost of a read (scheduler, block and API call
+overhead) from the cost that scales with the samples moved. The replay
+device copies from memory, so the per-call figure is the floor the host
+adds; a real device adds its own USB cost on top.
+
+    signal_hound_read_bench.py --source sm
+    signal_hound_read_bench.py --source bb --sizes 512,4096,32768 --report bb.json
+'''
+
+import argparse
+import json
+import os
+import sys
+import tempfile
+import time
+
+import numpy as np
+from gnuradio import blocks, gr
+from gnuradio import signal_hound
+
+
+def write_recording(base, rate, center, samples):
+    '''Write noise as a ci16 SigMF recording.'''
+    rng = np.random.default_rng(1)
+    raw = np.clip(rng.standard_normal(2 * samples) * 300, -32768, 32767).astype(np.int16)
+    raw.tofile(base + '.sigmf-data')
+
+    meta = {
+        'global': {'core:datatype': 'ci16_le', 'core:sample_rate': rate,
+                   'core:version': '1.0.0'},
+        'captures': [{'core:sample_start': 0, 'core:frequency': center}],
+        'annotations': [],
+    }
+    with open(base + '.sigmf-meta', 'w') as f:
+        json.dump(meta, f)
+    return base + '.sigmf-meta'
+
+
+def make_source(kind, center, recording):
+    if kind == 'sm':
+        return signal_hound.sm_series(center, 0.0, -1, 1, True, False, 40e6, 'SM200B',
+                                      '192.168.2.2', '192.168.2.10', 51665, 0.0,
+                                      recording, False)
+    if kind == 'bb':
+        return signal_hound.bb_series(center, 0.0, 1, 27e6, False, 0.0, recording, False)
+    return signal_hound.sp_series(0.0, -1, center, 1, True, 40e6, False, 0.0,
+                                  recording, False)
+
+
+def run(args, recording, size):
+    '''Seconds taken to read args.samples samples in requests of size.'''
+    tb = gr.top_block('signal_hound read bench')
+    src = make_source(args.source, args.center, recording)
+    src.set_read_latency(size / args.rate)
+    src.set_max_noutput_items(size)
+    head = blocks.head(gr.sizeof_gr_complex, args.samples)
+    sink = blocks.null_sink(gr.sizeof_gr_complex)
+    tb.connect(src, head, sink)
+
+    t0 = time.perf_counter()
+    tb.run()
+    return time.perf_counter() - t0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--source', choices=('sm', 'bb', 'sp'), default='sm')
+    parser.add_argument('--rate', type=float, default=40e6,
+                        help='rate of the generated recording')
+    parser.add_argument('--center', type=float, default=2.4e9)
+    parser.add_argument('--sizes', default='64,256,1024,4096,16384,65536',
+                        help='comma-separated request sizes in samples')
+    parser.add_argument('--samples', type=int, default=1 << 26,
+                        help='samples read per request size')
+    parser.add_argument('--repeat', type=int, default=3,
+                        help='runs per size, the fastest is kept')
+    parser.add_argument('--report', default='', help='JSON report path')
+    args = parser.parse_args()
+
+    sizes = [int(s) for s in args.sizes.split(',')]
+    tmp = tempfile.TemporaryDirectory(prefix='signal_hound_bench')
+    recording = write_recording(os.path.join(tmp.name, 'bench'), args.rate, args.center,
+                                1 << 20)
+
+    results = []
+    print('%10s %12s %12s %12s' % ('request', 'ns/sample', 'ns/call', 'MS/s'))
+    for size in sizes:
+        seconds = min(run(args, recording, size) for _ in range(args.repeat))
+        ns_sample = seconds * 1e9 / args.samples
+        results.append({'request': size, 'seconds': seconds, 'ns_per_sample': ns_sample,
+                        'ns_per_call': ns_sample * size})
+        print('%10d %12.3f %12.0f %12.1f' % (size, ns_sample, ns_sample * size,
+                                             args.samples / seconds / 1e6))
+
+    fit = {}
+    if len(sizes) > 1:
+        slope, intercept = np.polyfit([1.0 / s for s in sizes],
+                                      [r['ns_per_sample'] for r in results], 1)
+        fit = {'ns_per_call': slope, 'ns_per_sample': intercept}
+        print('fit: %.0f ns per call + %.3f ns per sample' % (slope, intercept))
+
+    if args.report:
+        with open(args.report, 'w') as f:
+            json.dump({'source': args.source, 'rate': args.rate, 'samples': args.samples,
+                       'results': results, 'fit': fit,
+                       'host': {'node': os.uname().nodename, 'cpus': os.cpu_count(),
+                                'gnuradio': gr.version()}}, f, indent=2)
+        print('report written to ' + args.report)
+
+    tmp.cleanup()
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,260 @@
+#!/usr/bin/env python3
+#
+# Copyright 2025 Signal Hound.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+'''
+Sustained-rate soak test of the Signal Hound sources.
+
+A source block is run against a replayed recording, paced at the rate under
+test, with a representative FFT load downstream, while another thread keeps
+retuning it and changing its reference level. The run fails on any device
+overrun, on latency through the output buffer above the limit, on the output
+buffer backlog growing over the run or on anonymous memory growing past the
+limit. A JSON report is written for archiving with the release.
+
+    signal_hound_soak.py --source sm --rate 250e6 --duration 14400
+    signal_hound_soak.py --source bb --rate 40e6 --duration 14400
+
+No hardware is needed. Without --recording a few seconds of noise and tones
+are generated and looped.
+'''
+
+import argparse
+import json
+import os
+import platform
+import random
+import sys
+import tempfile
+import threading
+import time
+
+import numpy as np
+from gnuradio import blocks, fft, gr
+from gnuradio.fft import window
+from gnuradio import signal_hound
+
+
+def write_recording(base, rate, center, samples):
+    '''Write noise and a few tones as a ci16 SigMF recording.'''
+    rng = np.random.default_rng(1)
+    n = np.arange(samples)
+    iq = 0.01 * (rng.standard_normal(samples) + 1j * rng.standard_normal(samples))
+    for offset, level in ((-0.3, 0.2), (0.05, 0.3), (0.25, 0.1)):
+        iq += level * np.exp(2j * np.pi * offset * n)
+    raw = np.empty(2 * samples, dtype=np.int16)
+    raw[0::2] = np.clip(iq.real * 32767, -32768, 32767)
+    raw[1::2] = np.clip(iq.imag * 32767, -32768, 32767)
+    raw.tofile(base + '.sigmf-data')
+
+    meta = {
+        'global': {'core:datatype': 'ci16_le', 'core:sample_rate': rate,
+                   'core:version': '1.0.0'},
+        'captures': [{'core:sample_start': 0, 'core:frequency': center}],
+        'annotations': [],
+    }
+    with open(base + '.sigmf-meta', 'w') as f:
+        json.dump(meta, f)
+    return base + '.sigmf-meta'
+
+
+def make_source(kind, center, recording, paced):
+    if kind == 'sm':
+        return signal_hound.sm_series(center, 0.0, -1, 1, True, False, 40e6, 'SM200B',
+                                      '192.168.2.2', '192.168.2.10', 51665, 0.0,
+                                      recording, paced)
+    if kind == 'bb':
+        return signal_hound.bb_series(center, 0.0, 1, 27e6, False, 0.0, recording, paced)
+    return signal_hound.sp_series(0.0, -1, center, 1, True, 40e6, False, 0.0,
+                                  recording, paced)
+
+
+class soak_graph(gr.top_block):
+
+    def __init__(self, args, recording):
+        gr.top_block.__init__(self, 'signal_hound soak')
+        self.src = make_source(args.source, args.center, recording, not args.unpaced)
+        self.sink = blocks.null_sink(gr.sizeof_gr_complex)
+
+        if args.fft_size > 0:
+            n = args.fft_size
+            self.s2v = blocks.stream_to_vector(gr.sizeof_gr_complex, n)
+            self.fft = fft.fft_vcc(n, True, window.blackmanharris(n), True, args.fft_threads)
+            self.mag = blocks.complex_to_mag_squared(n)
+            self.fft_sink = blocks.null_sink(gr.sizeof_float * n)
+            self.connect(self.src, self.s2v, self.fft, self.mag, self.fft_sink)
+        self.connect(self.src, self.sink)
+
+    def read(self):
+        '''Items the slowest reader of the source has consumed.'''
+        readers = [self.sink] + ([self.s2v] if hasattr(self, 's2v') else [])
+        return min(r.nitems_read(0) for r in readers)
+
+
+def anon_rss():
+    '''Anonymous resident memory in bytes, the mapped recording excluded.'''
+    with open('/proc/self/status') as f:
+        for line in f:
+            if line.startswith('RssAnon:'):
+                return int(line.split()[1]) * 1024
+    return 0
+
+
+def percentile(values, p):
+    return float(np.percentile(values, p)) if values else 0.0
+
+
+def toggle(tb, args, stop, calls):
+    '''Retune within the recorded span and change reference level.'''
+    rng = random.Random(2)
+    while not stop.wait(args.toggle_period):
+        if rng.random() < 0.5:
+            tb.src.set_center(args.center + rng.uniform(-0.2, 0.2) * args.rate)
+            calls['set_center'] += 1
+        else:
+            tb.src.set_reflevel(rng.choice((-20.0, -10.0, 0.0)))
+            calls['set_reflevel'] += 1
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--source', choices=('sm', 'bb', 'sp'), default='sm')
+    parser.add_argument('--rate', type=float, default=250e6, help='sample rate under test')
+    parser.add_argument('--center', type=float, default=2.4e9)
+    parser.add_argument('--duration', type=float, default=60.0, help='seconds to run')
+    parser.add_argument('--warmup', type=float, default=5.0,
+                        help='seconds excluded from latency and memory checks')
+    parser.add_argument('--recording', default='',
+                        help='SigMF or raw recording to replay instead of generated samples')
+    parser.add_argument('--recording-samples', type=int, default=1 << 22)
+    parser.add_argument('--unpaced', action='store_true',
+                        help='replay as fast as possible rather than at the rate')
+    parser.add_argument('--fft-size', type=int, default=4096, help='0 disables the FFT load')
+    parser.add_argument('--fft-threads', type=int, default=1)
+    parser.add_argument('--toggle-period', type=float, default=0.5,
+                        help='seconds between setter calls, 0 disables them')
+    parser.add_argument('--sample-period', type=float, default=0.05)
+    parser.add_argument('--max-latency', type=float, default=0.05,
+                        help='p99 output buffer latency limit in seconds')
+    parser.add_argument('--max-memory-growth', type=float, default=32.0,
+                        help='anonymous memory growth limit in MB')
+    parser.add_argument('--trace', default='', help='write a Chrome trace of the run here')
+    parser.add_argument('--report', default='', help='JSON report path')
+    args = parser.parse_args()
+
+    tmp = None
+    recording = args.recording
+    if not recording:
+        tmp = tempfile.TemporaryDirectory(prefix='signal_hound_soak')
+        recording = write_recording(os.path.join(tmp.name, 'soak'), args.rate, args.center,
+                                    args.recording_samples)
+
+    if args.trace:
+        signal_hound.tracing.enable()
+
+    tb = soak_graph(args, recording)
+    stop = threading.Event()
+    calls = {'set_center': 0, 'set_reflevel': 0}
+    toggler = threading.Thread(target=toggle, args=(tb, args, stop, calls), daemon=True)
+
+    tb.start()
+    t0 = time.monotonic()
+    if args.toggle_period > 0:
+        toggler.start()
+
+    latencies = []
+    backlog = []
+    rss_start = None
+    rss_peak = 0
+    while True:
+        time.sleep(args.sample_period)
+        elapsed = time.monotonic() - t0
+        if elapsed >= args.duration:
+            break
+        if elapsed < args.warmup:
+            continue
+        # The source waits on its slowest reader, so that sets the backlog
+        queued = tb.src.nitems_written(0) - tb.read()
+        backlog.append(queued)
+        latencies.append(queued / args.rate)
+        rss = anon_rss()
+        if rss_start is None:
+            rss_start = rss
+        rss_peak = max(rss_peak, rss)
+
+    samples = tb.src.nitems_written(0)
+    overruns = tb.src.overruns()
+    rss_end = anon_rss()
+    stop.set()
+    tb.stop()
+    tb.wait()
+    elapsed = time.monotonic() - t0
+
+    if args.trace:
+        signal_hound.tracing.dump(args.trace)
+
+    failures = []
+    if overruns:
+        failures.append('%d device overruns' % overruns)
+    p99 = percentile(latencies, 99)
+    if p99 > args.max_latency:
+        failures.append('p99 latency %.3f s above %.3f s' % (p99, args.max_latency))
+    quarter = len(backlog) // 4
+    if quarter:
+        first = float(np.median(backlog[:quarter]))
+        last = float(np.median(backlog[-quarter:]))
+        if last > 2 * first + tb.src.output_multiple() + args.fft_size:
+            failures.append('output backlog grew from %d to %d samples' % (first, last))
+    growth = (rss_end - (rss_start or rss_end)) / 1e6
+    if growth > args.max_memory_growth:
+        failures.append('memory grew %.1f MB' % growth)
+    achieved = samples / elapsed
+    if not args.unpaced and achieved < 0.99 * args.rate:
+        failures.append('sustained %.3g S/s of %.3g S/s' % (achieved, args.rate))
+
+    report = {
+        'source': args.source,
+        'rate': args.rate,
+        'paced': not args.unpaced,
+        'duration': elapsed,
+        'recording': args.recording or 'generated',
+        'fft_size': args.fft_size,
+        'samples': samples,
+        'achieved_rate': achieved,
+        'overruns': overruns,
+        'setter_calls': calls,
+        'latency': {
+            'p50': percentile(latencies, 50),
+            'p99': p99,
+            'p99.9': percentile(latencies, 99.9),
+            'max': max(latencies) if latencies else 0.0,
+        },
+        'memory': {'start': rss_start, 'peak': rss_peak, 'end': rss_end},
+        'host': {'node': platform.node(), 'machine': platform.machine(),
+                 'cpus': os.cpu_count(), 'gnuradio': gr.version()},
+        'started': time.strftime('%Y-%m-%dT%H:%M:%S', time.localtime(time.time() - elapsed)),
+        'passed': not failures,
+        'failures': failures,
+    }
+
+    path = args.report or 'soak-%s-%s.json' % (args.source, time.strftime('%Y%m%d-%H%M%S'))
+    with open(path, 'w') as f:
+        json.dump(report, f, indent=2)
+
+    print('%s %.3g S/s for %.0f s: %s' % (args.source, achieved, elapsed,
+                                          'PASS' if not failures else 'FAIL'))
+    for failure in failures:
+        print('  ' + failure)
+    print('report written to ' + path)
+
+    if tmp:
+        tmp.cleanup()
+    return 0 if not failures else 1
+
+
+if __name__ == '__main__':
+    sys.exit(main())
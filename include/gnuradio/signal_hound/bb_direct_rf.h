@@ -0,0 +1,60 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_BB_DIRECT_RF_H
+#define INCLUDED_SIGNAL_HOUND_BB_DIRECT_RF_H
+
+#include <gnuradio/signal_hound/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Direct RF sampling from a BB60C/D, bypassing the downconverter.
+ * \ingroup signal_hound
+ *
+ * The device digitizes the low band directly, so one capture covers HF
+ * from DC to half the sample rate instead of many retuned I/Q windows.
+ * The output is the real-valued sample stream as float.
+ *
+ * With \p hilbert set the block instead outputs complex samples: the real
+ * stream is shifted down by a quarter of its rate, filtered by a half-band
+ * low pass and decimated by two, giving the analytic signal at half the
+ * rate centered on a quarter of the direct RF rate. An rx_freq tag carries
+ * that center and rx_rate the output rate.
+ *
+ * rx_time tags give the device timestamp after each configuration and
+ * after sample loss, corrected for the delay of the half-band filter.
+ *
+ * Experimental: the vendor API does not document the direct RF sample
+ * layout, so the block is only built with ENABLE_BB_DIRECT_RF.
+ */
+class SIGNAL_HOUND_API bb_direct_rf : virtual public gr::sync_block
+{
+public:
+    typedef std::shared_ptr<bb_direct_rf> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of signal_hound::bb_direct_rf.
+     *
+     * \param reflevel Reference level in dBm
+     * \param hilbert Output the complex analytic signal instead of real samples
+     * \param taps Half-band filter length used when \p hilbert is set
+     */
+    static sptr make(double reflevel, bool hilbert = false, int taps = 63);
+
+    virtual void set_reflevel(double reflevel) = 0;
+
+    //! Real sample rate of the direct RF stream, 0 before streaming starts
+    virtual double sample_rate() = 0;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_BB_DIRECT_RF_H */
@@ -31,17 +31,128 @@ namespace gr {
        * constructor is in a private implementation
        * class. signal_hound::bb_series::make is the public interface for
        * creating new instances.
+       *
+       * A SigMF or raw recording named by \p replay stands in for the
+       * device, served through the same reads, tagging and retune code.
+       * \p replay_paced plays it in real time; otherwise it is read as
+       * fast as the flowgraph takes it.
+       *
+       * With \p vlen above one, output items are frames of that many
+       * samples read straight from the device, for FFT consumers to take
+       * without reframing. Consecutive frames share \p overlap samples.
+       * A frame never spans a retune or sample loss; framing restarts on
+       * the first sample after one, where the read timestamp falls.
        */
       static sptr make(double center, 
                        double reflevel, 
                        int decimation, 
                        double bandwidth, 
-                       bool purge);
+                       bool purge,
+                       double idle_timeout = 0.0,
+                       std::string replay = "",
+                       bool replay_paced = true,
+                       int vlen = 1,
+                       int overlap = 0);
       virtual void set_center(double center) = 0;
       virtual void set_reflevel(double reflevel) = 0;
       virtual void set_decimation(int decimation) = 0;
       virtual void set_purge(bool purge) = 0;
       virtual void set_bandwidth(double bandwidth) = 0;
+
+      /*!
+       * \brief Seconds the flowgraph must be stopped before the device is
+       * put into standby. Zero or negative keeps the device powered.
+       */
+      virtual void set_idle_timeout(double seconds) = 0;
+
+      /*!
+       * \brief Start waking the device from standby ahead of an expected
+       * start(), hiding the wake-up latency from the restart.
+       */
+      virtual void prewake() = 0;
+
+      //! Smoothed time in seconds the device has taken to leave standby.
+      virtual double wake_latency() = 0;
+
+      //! Reads that reported samples lost before them, a device overrun.
+      virtual uint64_t overruns() = 0;
+
+      /*!
+       * \brief Forward the I/Q stream as VITA-49.0 packets over UDP directly
+       * from the device read. An empty destination disables forwarding.
+       *
+       * \param destination "host:port" of the receiver
+       * \param samples_per_packet I/Q samples per data packet. The default
+       *        fits a 1500-byte MTU; larger packets need jumbo frames
+       */
+      virtual void set_vrt_destination(const std::string& destination,
+                                       int samples_per_packet = 180) = 0;
+
+      /*!
+       * \brief Publish the I/Q stream into a shared-memory ring that any
+       * number of shm_source blocks in other processes can read. An empty
+       * name disables publishing.
+       *
+       * \param name Shared memory object name
+       * \param capacity Ring size in samples, rounded up to a power of two
+       */
+      virtual void set_shm_publish(const std::string& name,
+                                   int capacity = 1 << 24) = 0;
+
+      /*!
+       * \brief Record the I/Q stream to disk in the compact block floating
+       * point format read by bfp_file_source. An empty path stops recording.
+       *
+       * \param path File to create
+       * \param mantissa_bits 8 or 12 bits per I and Q value
+       * \param max_error When above zero, the largest absolute error allowed
+       *        per sample; quiet blocks then drop to fewer bits
+       */
+      virtual void set_recording(const std::string& path,
+                                 int mantissa_bits = 8,
+                                 double max_error = 0.0) = 0;
+
+      /*!
+       * \brief Publish the I/Q stream on the "pdus" message port as PDUs of
+       * \p samples_per_pdu samples, drawn from a pool of \p pool_size
+       * allocated here and reused once consumers drop them. The metadata
+       * carries rx_time_ns, rx_freq, rx_rate and sample_loss. Zero samples
+       * stops publishing.
+       */
+      virtual void set_pdu_output(int samples_per_pdu, int pool_size = 64) = 0;
+
+      /*!
+       * \brief Trade latency for per-call overhead. Device reads are shaped
+       * into chunks of whole device transfers covering about this much time.
+       * Zero accepts any request size the scheduler offers. Applied with
+       * the next reconfiguration, as the work thread runs it.
+       */
+      virtual void set_read_latency(double seconds) = 0;
+
+      /*!
+       * \brief Select where sample timestamps come from. "internal" uses
+       * the host clock. "gps" first sets the host clock offset from the
+       * NMEA RMC sentences of a GPS receiver on serial port \p com_port,
+       * then has the device time stamp samples against the GPS PPS on its
+       * trigger input. Port 2 is set to a rising edge trigger input for the
+       * PPS; "internal" returns it to its default.
+       *
+       * rx_time tags are only added where the timestamps stop following
+       * from the sample count: after a reconfiguration, after sample loss
+       * and, with GPS time, where the device timestamp moves.
+       */
+      virtual void set_time_source(const std::string& source,
+                                   int com_port = 0,
+                                   int baud_rate = 38400) = 0;
+
+      /*!
+       * \brief Output samples at exactly \p rate. The device runs at the
+       * slowest power-of-two decimation still at or above it and a
+       * polyphase arbitrary resampler in the block makes up the rest,
+       * replacing the decimation setting. The usable bandwidth is 80% of
+       * \p rate. Zero turns the resampler off.
+       */
+      virtual void set_output_rate(double rate) = 0;
     };
 
   } // namespace signal_hound
@@ -0,0 +1,49 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_BFP_FILE_SOURCE_H
+#define INCLUDED_SIGNAL_HOUND_BFP_FILE_SOURCE_H
+
+#include <gnuradio/signal_hound/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Plays back a block floating point recording made with
+ * set_recording() on a Signal Hound source.
+ * \ingroup signal_hound
+ *
+ * rx_freq and rx_rate tags are emitted whenever the recorded tuning
+ * changes, and an rx_time tag at the start, after every seek and wherever
+ * the recording marked sample loss.
+ */
+class SIGNAL_HOUND_API bfp_file_source : virtual public gr::sync_block
+{
+public:
+    typedef std::shared_ptr<bfp_file_source> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of signal_hound::bfp_file_source.
+     *
+     * \param filename Recording to play
+     * \param repeat Start over at the end of the file
+     */
+    static sptr make(const std::string& filename, bool repeat = false);
+
+    //! Continue playback from sample \p sample, false if out of range
+    virtual bool seek(uint64_t sample) = 0;
+
+    //! Number of samples in the recording
+    virtual uint64_t samples() = 0;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_BFP_FILE_SOURCE_H */
@@ -0,0 +1,71 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_LATENCY_PROBE_H
+#define INCLUDED_SIGNAL_HOUND_LATENCY_PROBE_H
+
+#include <gnuradio/signal_hound/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Measures generator to receiver loopback latency.
+ * \ingroup signal_hound
+ *
+ * Detects the chirp markers inserted by vsg_series::set_latency_markers()
+ * by correlation and pairs each one with the time it was handed to the
+ * generator. The measured latency covers both schedulers, the API queues,
+ * USB and the RF path. Every measurement is published in seconds on the
+ * "latency" message port and accumulated in a histogram.
+ *
+ * The generator and probe must run in the same process.
+ */
+class SIGNAL_HOUND_API latency_probe : virtual public gr::sync_block
+{
+public:
+    typedef std::shared_ptr<latency_probe> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of signal_hound::latency_probe.
+     *
+     * \param sample_rate Input sample rate
+     * \param bandwidth Marker chirp bandwidth, as given to the generator
+     * \param duration Marker chirp duration, as given to the generator
+     * \param threshold Normalized correlation, 0 to 1, needed to detect a marker
+     * \param bin_width Histogram bin width in seconds
+     * \param bins Number of histogram bins, the last collects overflows
+     */
+    static sptr make(double sample_rate,
+                     double bandwidth = 1e6,
+                     double duration = 1e-3,
+                     double threshold = 0.5,
+                     double bin_width = 1e-4,
+                     int bins = 1000);
+
+    //! Latency counts per bin_width() wide bin
+    virtual std::vector<uint64_t> histogram() = 0;
+    virtual double bin_width() = 0;
+
+    //! Markers detected and paired with an injection
+    virtual uint64_t detections() = 0;
+    //! Markers detected with no injection to pair them with
+    virtual uint64_t unmatched() = 0;
+
+    virtual double min_latency() = 0;
+    virtual double mean_latency() = 0;
+    virtual double max_latency() = 0;
+
+    //! Clear the histogram and statistics
+    virtual void reset() = 0;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_LATENCY_PROBE_H */
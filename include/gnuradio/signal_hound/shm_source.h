@@ -0,0 +1,47 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SHM_SOURCE_H
+#define INCLUDED_SIGNAL_HOUND_SHM_SOURCE_H
+
+#include <gnuradio/signal_hound/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Reads the I/Q published to shared memory by a Signal Hound source.
+ * \ingroup signal_hound
+ *
+ * Any number of flowgraphs in other processes can attach to the same ring
+ * without adding load to the device owner. The stream joins live. rx_freq
+ * and rx_rate tags follow retunes, and an rx_time tag marks the start of
+ * the stream and every point where samples were skipped. The stream ends
+ * once the writing process has exited. Only processes of the user that
+ * runs the writer can attach.
+ */
+class SIGNAL_HOUND_API shm_source : virtual public gr::sync_block
+{
+public:
+    typedef std::shared_ptr<shm_source> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of signal_hound::shm_source.
+     *
+     * \param name Shared memory name given to set_shm_publish() on the source
+     */
+    static sptr make(const std::string& name);
+
+    //! Number of times this reader fell a full ring behind and skipped ahead
+    virtual uint64_t overruns() = 0;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SHM_SOURCE_H */
@@ -0,0 +1,116 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SM_CUE_CAPTURE_H
+#define INCLUDED_SIGNAL_HOUND_SM_CUE_CAPTURE_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/signal_hound/api.h>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Sweeps a band on an SM200/SM435 and captures I/Q at whatever it finds.
+ * \ingroup signal_hound
+ *
+ * A device thread alternates between sweep and I/Q streaming mode without
+ * going through the scheduler. Each sweep is published on "sweeps" and
+ * searched for peaks above the threshold, or above the mask when one is
+ * set. The strongest new peaks are then captured in I/Q mode, centered on
+ * the peak, and published on "captures" as complex PDUs carrying the
+ * detection. Peaks captured within the holdoff are not captured again.
+ *
+ * In "segmented" mode each detection gets one segmented I/Q capture of
+ * \p capture_len samples at the device's full segmented capture rate,
+ * started immediately through smSegIQCaptureStart. In "streaming" mode the
+ * strongest detection is followed for \p dwell seconds as consecutive
+ * decimated I/Q streaming reads before sweeping resumes. Each capture
+ * carries its actual rx_rate and bandwidth.
+ *
+ * The reaction time of a capture is the time from the end of the sweep
+ * that saw the peak to the first captured sample.
+ */
+class SIGNAL_HOUND_API sm_cue_capture : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<sm_cue_capture> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of signal_hound::sm_cue_capture.
+     *
+     * \param start Sweep start frequency
+     * \param stop Sweep stop frequency
+     * \param rbw Sweep resolution bandwidth
+     * \param reflevel Reference level in dBm for both modes
+     * \param threshold Detection level in dBm when no mask is set
+     * \param capture_len Samples per capture
+     * \param decimation Streaming I/Q decimation from 50 MS/s, a power of two
+     * \param mode "segmented" or "streaming"
+     * \param max_captures Most detections captured after one sweep
+     * \param holdoff Seconds before a captured frequency is captured again
+     * \param dwell Seconds a streaming capture follows its detection
+     * \param type Device type as for sm_series
+     * \param hostAddr Host address for networked devices
+     * \param deviceAddr Device address for networked devices
+     * \param port Port for networked devices
+     */
+    static sptr make(double start,
+                     double stop,
+                     double rbw,
+                     double reflevel,
+                     double threshold,
+                     int capture_len = 16384,
+                     int decimation = 8,
+                     const std::string& mode = "segmented",
+                     int max_captures = 4,
+                     double holdoff = 1.0,
+                     double dwell = 0.1,
+                     const std::string& type = "SM200B",
+                     const std::string& hostAddr = "192.168.2.2",
+                     const std::string& deviceAddr = "192.168.2.10",
+                     uint16_t port = 51665);
+
+    virtual void set_span(double start, double stop) = 0;
+    virtual void set_rbw(double rbw) = 0;
+    virtual void set_reflevel(double reflevel) = 0;
+    virtual void set_threshold(double threshold) = 0;
+
+    /*!
+     * Detect against a limit line through (\p freqs, \p levels) instead of
+     * the threshold. Levels are interpolated linearly between points and
+     * held past the ends. Empty vectors go back to the threshold.
+     */
+    virtual void set_mask(const std::vector<double>& freqs,
+                          const std::vector<double>& levels) = 0;
+
+    virtual void set_capture(int capture_len, int decimation) = 0;
+    virtual void set_mode(const std::string& mode) = 0;
+    virtual void set_max_captures(int max_captures) = 0;
+    virtual void set_holdoff(double holdoff) = 0;
+    virtual void set_dwell(double dwell) = 0;
+
+    //! Sweeps taken since start()
+    virtual uint64_t sweeps() = 0;
+
+    //! Captures published since start()
+    virtual uint64_t captures() = 0;
+
+    //! Reaction time of the most recent detection in seconds
+    virtual double last_reaction_time() = 0;
+
+    //! Mean reaction time since start() in seconds
+    virtual double mean_reaction_time() = 0;
+
+    //! Longest reaction time since start() in seconds
+    virtual double max_reaction_time() = 0;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SM_CUE_CAPTURE_H */
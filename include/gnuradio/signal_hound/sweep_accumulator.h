@@ -0,0 +1,68 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SWEEP_ACCUMULATOR_H
+#define INCLUDED_SIGNAL_HOUND_SWEEP_ACCUMULATOR_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/signal_hound/api.h>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Max-hold, min-hold, average and occupancy over a stream of sweeps.
+ * \ingroup signal_hound
+ *
+ * Sweep PDUs arriving on "sweeps", as published by sm_cue_capture, are
+ * folded into all four statistics in one pass. Every \p interval seconds
+ * the current state is published on "max_hold", "min_hold", "average" and
+ * "occupancy", each as a sweep PDU whose metadata also carries the number
+ * of sweeps in the window. Occupancy is the fraction of those sweeps in
+ * which each bin was above the threshold.
+ *
+ * The window restarts on reset(), when the sweep frequencies change, and
+ * after every snapshot if \p reset_on_snapshot is set. Memory does not grow
+ * with the length of the window.
+ */
+class SIGNAL_HOUND_API sweep_accumulator : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<sweep_accumulator> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of signal_hound::sweep_accumulator.
+     *
+     * \param average "linear" for the mean over the window, "exponential"
+     *        for an exponential average
+     * \param alpha Weight of the newest sweep in the exponential average
+     * \param threshold Occupancy threshold in dBm
+     * \param interval Seconds between snapshots, 0 for every sweep
+     * \param reset_on_snapshot Start a new window after each snapshot
+     */
+    static sptr make(const std::string& average = "linear",
+                     double alpha = 0.1,
+                     double threshold = -80.0,
+                     double interval = 1.0,
+                     bool reset_on_snapshot = false);
+
+    virtual void set_average(const std::string& average, double alpha) = 0;
+    virtual void set_threshold(double threshold) = 0;
+    virtual void set_interval(double interval) = 0;
+    virtual void set_reset_on_snapshot(bool reset_on_snapshot) = 0;
+
+    //! Start a new window
+    virtual void reset() = 0;
+
+    //! Sweeps in the current window
+    virtual uint64_t sweeps() = 0;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SWEEP_ACCUMULATOR_H */
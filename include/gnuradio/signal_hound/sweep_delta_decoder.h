@@ -0,0 +1,45 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_DECODER_H
+#define INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_DECODER_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/signal_hound/api.h>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Turns sweep_delta_encoder frames back into sweeps.
+ * \ingroup signal_hound
+ *
+ * Byte PDUs on "encoded" are decoded and published on "sweeps" as sweep
+ * PDUs. Frames that are corrupt, or whose key frame was lost, are
+ * dropped; decoding resumes at the next key frame.
+ */
+class SIGNAL_HOUND_API sweep_delta_decoder : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<sweep_delta_decoder> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of signal_hound::sweep_delta_decoder.
+     */
+    static sptr make();
+
+    //! Sweeps decoded since start()
+    virtual uint64_t frames() = 0;
+
+    //! Frames dropped since start()
+    virtual uint64_t dropped() = 0;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_DECODER_H */
@@ -0,0 +1,60 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_ENCODER_H
+#define INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_ENCODER_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/signal_hound/api.h>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Delta codes sweeps for sending over a slow link.
+ * \ingroup signal_hound
+ *
+ * Sweep PDUs on "sweeps" are published on "encoded" as byte PDUs holding
+ * only the bins that moved more than \p threshold dB away from the last
+ * key frame. A key frame carrying every bin goes out every \p key_interval
+ * sweeps. The bytes are self-describing, so they can go to a socket as
+ * they are and be turned back into sweeps by sweep_delta_decoder. The PDU
+ * metadata says whether the frame is a key frame.
+ */
+class SIGNAL_HOUND_API sweep_delta_encoder : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<sweep_delta_encoder> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of signal_hound::sweep_delta_encoder.
+     *
+     * \param threshold dB a bin must move to be sent
+     * \param key_interval Sweeps from one key frame to the next, 0 to send
+     *        key frames only when needed
+     * \param quantum Resolution of the coded levels in dB
+     */
+    static sptr
+    make(double threshold = 0.5, int key_interval = 100, double quantum = 0.01);
+
+    virtual void set_threshold(double threshold) = 0;
+    virtual void set_key_interval(int key_interval) = 0;
+
+    //! Bytes of float32 traces in over bytes out, since start()
+    virtual double compression_ratio() = 0;
+
+    //! Frames sent since start()
+    virtual uint64_t frames() = 0;
+
+    //! Key frames among them
+    virtual uint64_t key_frames() = 0;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_ENCODER_H */
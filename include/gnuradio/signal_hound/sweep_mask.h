@@ -0,0 +1,76 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SWEEP_MASK_H
+#define INCLUDED_SIGNAL_HOUND_SWEEP_MASK_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/signal_hound/api.h>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Reduces sweeps to limit violations and a peak table.
+ * \ingroup signal_hound
+ *
+ * Each sweep PDU arriving on "sweeps" is compared against the threshold,
+ * or the mask when one is set, and searched for peaks in the same pass.
+ * Only the results go out, as PDUs whose metadata is that of the sweep
+ * plus "count", and whose vector is float64 records:
+ *
+ *   "violations"  start Hz, stop Hz, peak Hz, peak dBm, dB over the limit
+ *   "peaks"       frequency Hz, level dBm, dB relative to the limit
+ *
+ * Violations are published only for sweeps that have any. Peaks are the
+ * strongest \p max_peaks local maxima above \p floor that stand at least
+ * \p excursion dB above their neighbouring valleys, strongest first.
+ */
+class SIGNAL_HOUND_API sweep_mask : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<sweep_mask> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of signal_hound::sweep_mask.
+     *
+     * \param threshold Limit in dBm when no mask is set
+     * \param hysteresis dB below the limit a violation must fall to end
+     * \param floor Lowest level in dBm reported as a peak
+     * \param excursion dB a peak must rise above its valleys
+     * \param max_peaks Peaks reported per sweep, 0 for none
+     */
+    static sptr make(double threshold = -80.0,
+                     double hysteresis = 1.0,
+                     double floor = -100.0,
+                     double excursion = 6.0,
+                     int max_peaks = 10);
+
+    virtual void set_threshold(double threshold) = 0;
+
+    /*!
+     * Compare against a limit line through (\p freqs, \p levels) instead of
+     * the threshold. Levels are interpolated linearly between points and
+     * held past the ends. Empty vectors go back to the threshold.
+     */
+    virtual void set_mask(const std::vector<double>& freqs,
+                          const std::vector<double>& levels) = 0;
+
+    virtual void set_hysteresis(double hysteresis) = 0;
+    virtual void set_peaks(double floor, double excursion, int max_peaks) = 0;
+
+    //! Sweeps compared since start()
+    virtual uint64_t sweeps() = 0;
+
+    //! Sweeps with at least one violation since start()
+    virtual uint64_t violating_sweeps() = 0;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SWEEP_MASK_H */
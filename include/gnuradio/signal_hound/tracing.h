@@ -0,0 +1,49 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_TRACING_H
+#define INCLUDED_SIGNAL_HOUND_TRACING_H
+
+#include <gnuradio/signal_hound/api.h>
+#include <string>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Span tracing of the module's blocks.
+ * \ingroup signal_hound
+ *
+ * When enabled, the blocks record how long each work() call, device API
+ * call, reconfiguration, ring wait and conversion took. Spans go to a
+ * fixed buffer per thread without locking, the newest 65536 kept, so
+ * tracing can stay on in a running flowgraph. dump() writes them in the
+ * Chrome trace event format, which chrome://tracing and Perfetto load
+ * next to GNU Radio's own traces; times are CLOCK_MONOTONIC.
+ *
+ * Setting GR_SIGNAL_HOUND_TRACE to a file name enables tracing at load
+ * and dumps to that file at exit.
+ */
+namespace tracing {
+
+//! Start or stop recording spans
+SIGNAL_HOUND_API void enable(bool on = true);
+SIGNAL_HOUND_API bool enabled();
+
+//! Discard the spans recorded so far, freeing the buffers of exited threads
+SIGNAL_HOUND_API void clear();
+
+//! Write the recorded spans to \p path as Chrome trace JSON. The spans of
+//! threads that have exited are written once, then freed with their buffer.
+SIGNAL_HOUND_API void dump(const std::string& path);
+
+} // namespace tracing
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_TRACING_H */
@@ -0,0 +1,45 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_VRT_SOURCE_H
+#define INCLUDED_SIGNAL_HOUND_VRT_SOURCE_H
+
+#include <gnuradio/signal_hound/api.h>
+#include <gnuradio/sync_block.h>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Receives the VITA-49.0 stream emitted by the Signal Hound sources.
+ * \ingroup signal_hound
+ *
+ * Data packets are unpacked to complex samples. Context packets are turned
+ * into rx_freq and rx_rate stream tags, and an rx_time tag is added at the
+ * start of the stream and after every detected packet loss.
+ */
+class SIGNAL_HOUND_API vrt_source : virtual public gr::sync_block
+{
+public:
+    typedef std::shared_ptr<vrt_source> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of signal_hound::vrt_source.
+     *
+     * \param address Local address to bind, e.g. "0.0.0.0"
+     * \param port UDP port to listen on
+     */
+    static sptr make(const std::string& address, int port);
+
+    //! Number of data packets detected as lost
+    virtual uint64_t packets_lost() = 0;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_VRT_SOURCE_H */
@@ -0,0 +1,63 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_VSG_FILE_REPLAY_H
+#define INCLUDED_SIGNAL_HOUND_VSG_FILE_REPLAY_H
+
+#include <gnuradio/block.h>
+#include <gnuradio/signal_hound/api.h>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Replays an I/Q file on a VSG60 without going through the scheduler.
+ * \ingroup signal_hound
+ *
+ * The file is memory mapped and large slices are handed straight to
+ * vsgSubmitIQ from a dedicated thread while the flowgraph runs. Complex
+ * float32, complex int16 and SigMF recordings are supported. A "done"
+ * message is published when a non-repeating replay finishes.
+ */
+class SIGNAL_HOUND_API vsg_file_replay : virtual public gr::block
+{
+public:
+    typedef std::shared_ptr<vsg_file_replay> sptr;
+
+    /*!
+     * \brief Return a shared_ptr to a new instance of signal_hound::vsg_file_replay.
+     *
+     * \param filename File to replay
+     * \param format "auto", "fc32", "sc16" or "sigmf". "auto" detects SigMF
+     *        and the .sc16/.cs16/.ci16 extensions, anything else is fc32.
+     * \param center Center frequency, 0 to use the SigMF capture frequency
+     * \param samplerate Sample rate, 0 to use the SigMF sample rate
+     * \param level Output level in dBm
+     * \param repeat Loop the segment until stopped
+     * \param start First sample of the segment
+     * \param count Samples in the segment, 0 for the rest of the file
+     */
+    static sptr make(const std::string& filename,
+                     const std::string& format = "auto",
+                     double center = 1e9,
+                     double samplerate = 0.0,
+                     double level = -20.0,
+                     bool repeat = true,
+                     uint64_t start = 0,
+                     uint64_t count = 0);
+
+    virtual void set_center(double center) = 0;
+    virtual void set_level(double level) = 0;
+
+    //! Samples handed to the API since start()
+    virtual uint64_t samples_submitted() = 0;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_VSG_FILE_REPLAY_H */
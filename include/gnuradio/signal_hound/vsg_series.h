@@ -36,12 +36,93 @@ public:
                      double samplerate,
                      double level,
                      int ioffset,
-                     int qoffset);
+                     int qoffset,
+                     double idle_timeout = 0.0);
     virtual void set_center(double center) = 0;
     virtual void set_samplerate(double samplerate) = 0;
     virtual void set_level(double level) = 0;
     virtual void set_ioffset(int ioffset) = 0;
     virtual void set_qoffset(int qoffset) = 0;
+
+    /*!
+     * \brief Seconds the flowgraph must be stopped before the API is put in
+     * power saving CPU mode. Zero or negative disables power saving.
+     */
+    virtual void set_idle_timeout(double seconds) = 0;
+
+    //! Leave power saving mode ahead of an expected start().
+    virtual void prewake() = 0;
+
+    //! Smoothed time in seconds taken to leave power saving mode.
+    virtual double wake_latency() = 0;
+
+    /*!
+     * \brief Periodically replace the transmitted samples with a chirp
+     * marker for latency_probe to detect in a receiver.
+     *
+     * \param interval Seconds between markers, zero disables them. Must be
+     *        longer than the largest latency to be measured.
+     * \param bandwidth Chirp sweep in Hz, within both sample rates
+     * \param duration Chirp length in seconds
+     */
+    virtual void set_latency_markers(double interval,
+                                     double bandwidth = 1e6,
+                                     double duration = 1e-3) = 0;
+
+    /*!
+     * \brief Frequency agility for hopping. Hops within \p span of the
+     * synthesizer frequency are made by rotating the samples on the host,
+     * sample accurately and without any API call. Hops further out retune
+     * the synthesizer with vsgSetFrequency between submissions. The API's
+     * own digital tuning is left alone: it flushes the output on every
+     * change and does not make retunes faster.
+     *
+     * Hops come from tx_freq stream tags and from the hop list. Without hop
+     * mode every hop is a synthesizer retune.
+     *
+     * \param enabled Enable digital hops
+     * \param span Width in Hz around the synthesizer frequency reachable
+     *        digitally, 0 for half the sample rate
+     */
+    virtual void set_hop_mode(bool enabled, double span = 0.0) = 0;
+
+    /*!
+     * \brief Cycle through \p frequencies, staying \p dwell seconds on
+     * each. An empty list stops hopping.
+     */
+    virtual void set_hop_list(const std::vector<double>& frequencies, double dwell) = 0;
+
+    //! Hops made by rotating the samples
+    virtual uint64_t digital_hops() = 0;
+
+    //! Hops that needed a synthesizer retune
+    virtual uint64_t retunes() = 0;
+
+    /*!
+     * \brief Run the device self-calibration when the temperature has
+     * drifted \p drift degrees C since the last one. Calibration aborts
+     * any output in progress, so it waits until no samples have been
+     * submitted for \p idle_gap seconds. Zero drift disables it.
+     *
+     * Temperature, USB status and throughput are polled once a second
+     * regardless and published as a dict on the "status" message port.
+     */
+    virtual void set_recal_policy(double drift, double idle_gap = 0.05) = 0;
+
+    //! Device temperature in degrees C at the last poll
+    virtual double temperature() = 0;
+
+    //! Samples per second submitted over the last poll period
+    virtual double throughput() = 0;
+
+    //! Submissions that blocked well past their playback time
+    virtual uint64_t stalls() = 0;
+
+    //! Polls that found the USB link in error
+    virtual uint64_t usb_errors() = 0;
+
+    //! Self-calibrations run
+    virtual uint64_t recals() = 0;
 };
 
 } // namespace signal_hound
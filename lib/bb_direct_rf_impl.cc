@@ -0,0 +1,225 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "bb_direct_rf_impl.h"
+#include "halfband.h"
+#include <gnuradio/io_signature.h>
+
+namespace gr {
+namespace signal_hound {
+
+// Defined in bb_series_impl.cc
+void ERROR_CHECK(bbStatus status);
+
+bb_direct_rf::sptr bb_direct_rf::make(double reflevel, bool hilbert, int taps)
+{
+    return gnuradio::make_block_sptr<bb_direct_rf_impl>(reflevel, hilbert, taps);
+}
+
+
+/*
+ * The private constructor
+ */
+bb_direct_rf_impl::bb_direct_rf_impl(double reflevel, bool hilbert, int taps)
+    : gr::sync_block("bb_direct_rf",
+                     gr::io_signature::make(0, 0, 0),
+                     gr::io_signature::make(
+                         1, 1, hilbert ? sizeof(gr_complex) : sizeof(float))),
+      _handle(-1),
+      _reflevel(reflevel),
+      _hilbert(hilbert),
+      _param_changed(true),
+      _sample_rate(0.0),
+      _tag_config(true),
+      _phase(0),
+      _delay_ns(0)
+{
+    std::cout << "\nAPI Version: " << bbGetAPIVersion() << "\n";
+
+    // Open device in the background, start() waits for it
+    _open.reset(new device_open("BB60", [this]() {
+        ERROR_CHECK(bbOpenDevice(&_handle));
+
+        uint32_t serial;
+        ERROR_CHECK(bbGetSerialNumber(_handle, &serial));
+        std::cout << "Serial Number: " << serial << "\n";
+    }));
+
+    if (_hilbert) {
+        // A gain of two keeps the amplitude of a real tone in its single
+        // analytic component
+        std::vector<float> real = halfband_taps(taps, 2.0f);
+        std::vector<gr_complex> complex(real.begin(), real.end());
+        _halfband.reset(new gr::filter::kernel::fft_filter_ccc(2, complex));
+
+        // The filter reads whole FFT blocks, set_taps() gives their size.
+        // Asking for whole blocks of output, as fft_filter_ccc does, keeps
+        // the input a whole number of blocks even when the size is odd.
+        int nsamples = _halfband->set_taps(complex);
+        set_output_multiple(nsamples);
+        _raw.resize(2 * nsamples);
+        _mixed.resize(2 * nsamples);
+    } else {
+        // Reads deliver real samples in pairs
+        set_output_multiple(2);
+    }
+}
+
+/*
+ * Our virtual destructor.
+ */
+bb_direct_rf_impl::~bb_direct_rf_impl()
+{
+    _open.reset();
+    if (_handle >= 0) {
+        bbAbort(_handle);
+        bbCloseDevice(_handle);
+    }
+}
+
+void bb_direct_rf_impl::set_reflevel(double reflevel)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _reflevel = reflevel;
+    _param_changed = true;
+}
+
+double bb_direct_rf_impl::sample_rate()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _sample_rate;
+}
+
+bool bb_direct_rf_impl::start()
+{
+    _open->wait();
+    return bb_direct_rf::start();
+}
+
+bool bb_direct_rf_impl::stop()
+{
+    {
+        gr::thread::scoped_lock lock(_mutex);
+        if (_handle >= 0) {
+            bbAbort(_handle);
+        }
+        _param_changed = true;
+    }
+    return bb_direct_rf::stop();
+}
+
+void bb_direct_rf_impl::configure()
+{
+    gr::thread::scoped_lock lock(_mutex);
+
+    ERROR_CHECK(bbConfigureRefLevel(_handle, _reflevel));
+    ERROR_CHECK(bbConfigureIQDataType(_handle, bbDataType32fc));
+    ERROR_CHECK(bbInitiate(_handle, BB_STREAMING, BB_STREAM_IQ | BB_DIRECT_RF));
+
+    double bandwidth;
+    ERROR_CHECK(bbQueryIQParameters(_handle, &_sample_rate, &bandwidth));
+    std::cout << "\nDirect RF Sample Rate: " << _sample_rate << "\n";
+
+    if (_hilbert) {
+        // Half the length of the filter, at the real rate
+        _delay_ns = (int64_t)((_halfband->ntaps() - 1) / 2 * 1.0e9 / _sample_rate);
+    }
+    _tag_config = true;
+    _phase = 0;
+}
+
+void bb_direct_rf_impl::tag_time(int64_t ns, bool config)
+{
+    uint64_t offset = nitems_written(0);
+    add_item_tag(0,
+                 offset,
+                 pmt::mp("rx_time"),
+                 pmt::make_tuple(pmt::from_uint64(ns / 1000000000),
+                                 pmt::from_double((ns % 1000000000) * 1.0e-9)));
+    if (config) {
+        double rate = _hilbert ? _sample_rate / 2.0 : _sample_rate;
+        double center = _hilbert ? _sample_rate / 4.0 : 0.0;
+        add_item_tag(0, offset, pmt::mp("rx_rate"), pmt::from_double(rate));
+        add_item_tag(0, offset, pmt::mp("rx_freq"), pmt::from_double(center));
+    }
+}
+
+//! Multiply by 1, -j, -1, j for mixer phases 0 to 3
+static inline gr_complex quarter_mix(float x, unsigned phase)
+{
+    switch (phase & 3) {
+    case 0:
+        return gr_complex(x, 0.0f);
+    case 1:
+        return gr_complex(0.0f, -x);
+    case 2:
+        return gr_complex(-x, 0.0f);
+    default:
+        return gr_complex(0.0f, x);
+    }
+}
+
+int bb_direct_rf_impl::work(int noutput_items,
+                            gr_vector_const_void_star& input_items,
+                            gr_vector_void_star& output_items)
+{
+    if (_param_changed) {
+        configure();
+        _param_changed = false;
+    }
+
+    // bb_api.h documents BB_DIRECT_RF only as "For BB60C/D devices", not
+    // how its samples are laid out. This assumes the real stream fills the
+    // 32fc read buffer two samples per slot, which is why the block is
+    // built only with ENABLE_BB_DIRECT_RF until that is confirmed.
+    int nreal = _hilbert ? 2 * noutput_items : noutput_items;
+    float* raw = static_cast<float*>(output_items[0]);
+    if (_hilbert) {
+        if ((int)_raw.size() < nreal) {
+            _raw.resize(nreal);
+            _mixed.resize(nreal);
+        }
+        raw = _raw.data();
+    }
+
+    int sampleLoss = 0, sec = 0, nano = 0;
+    ERROR_CHECK(bbGetIQUnpacked(
+        _handle, raw, nreal / 2, 0, 0, BB_FALSE, 0, &sampleLoss, &sec, &nano));
+
+    // Tagged where the timestamps stop following from the sample count
+    if (_tag_config || sampleLoss) {
+        tag_time((int64_t)sec * 1000000000 + nano - _delay_ns, _tag_config);
+        _tag_config = false;
+    }
+
+    if (!_hilbert) {
+        return noutput_items;
+    }
+
+    // Shift down by a quarter of the rate. The mixer repeats every four
+    // samples, so the bulk runs as a branch-free loop over whole cycles.
+    int i = 0;
+    for (; i < nreal && ((_phase + i) & 3); i++) {
+        _mixed[i] = quarter_mix(raw[i], _phase + i);
+    }
+    for (; i + 4 <= nreal; i += 4) {
+        _mixed[i] = gr_complex(raw[i], 0.0f);
+        _mixed[i + 1] = gr_complex(0.0f, -raw[i + 1]);
+        _mixed[i + 2] = gr_complex(-raw[i + 2], 0.0f);
+        _mixed[i + 3] = gr_complex(0.0f, raw[i + 3]);
+    }
+    for (; i < nreal; i++) {
+        _mixed[i] = quarter_mix(raw[i], _phase + i);
+    }
+    _phase = (_phase + nreal) & 3;
+
+    _halfband->filter(noutput_items, _mixed.data(), static_cast<gr_complex*>(output_items[0]));
+    return noutput_items;
+}
+
+} // namespace signal_hound
+} // namespace gr
@@ -0,0 +1,63 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_BB_DIRECT_RF_IMPL_H
+#define INCLUDED_SIGNAL_HOUND_BB_DIRECT_RF_IMPL_H
+
+#include "device_open.h"
+#include <gnuradio/filter/fft_filter.h>
+#include <gnuradio/signal_hound/bb_api.h>
+#include <gnuradio/signal_hound/bb_direct_rf.h>
+#include <memory>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+class bb_direct_rf_impl : public bb_direct_rf
+{
+private:
+    int _handle;
+    std::unique_ptr<device_open> _open;
+    double _reflevel;
+    bool _hilbert;
+
+    gr::thread::mutex _mutex;
+    bool _param_changed;
+    double _sample_rate;
+    bool _tag_config;
+
+    std::vector<float> _raw;
+
+    // Hilbert stage, _phase is the quarter-rate mixer position
+    std::unique_ptr<gr::filter::kernel::fft_filter_ccc> _halfband;
+    std::vector<gr_complex> _mixed;
+    unsigned _phase;
+    int64_t _delay_ns; // filter delay, the output lags the read timestamps
+
+    void configure(void);
+    void tag_time(int64_t ns, bool config);
+
+public:
+    bb_direct_rf_impl(double reflevel, bool hilbert, int taps);
+    ~bb_direct_rf_impl();
+
+    void set_reflevel(double reflevel);
+    double sample_rate(void);
+
+    bool start(void);
+    bool stop(void);
+
+    int work(int noutput_items,
+             gr_vector_const_void_star& input_items,
+             gr_vector_void_star& output_items);
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_BB_DIRECT_RF_IMPL_H */
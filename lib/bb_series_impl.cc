@@ -6,18 +6,35 @@
  */
 
 #include "bb_series_impl.h"
+#include "trace_span.h"
 #include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
 
 namespace gr {
     namespace signal_hound {
+        // Read granularity for the BB60. Unlike the SM and SP APIs, the BB API
+        // documents no transfer size, so this is a nominal figure.
+        static const int DEVICE_PACKET = 16384;
+        // Undecimated I/Q rate, where set_output_rate() starts its search
+        static const double BASE_RATE = 40.0e6;
+        // A GPS timestamp this far from the one predicted by the sample count is retagged
+        static const int64_t TIME_TOLERANCE_NS = 1000;
+
         using output_type = gr_complex;
         bb_series::sptr bb_series::make(double center,
                                         double reflevel,
                                         int decimation,
                                         double bandwidth,
-                                        bool purge)
+                                        bool purge,
+                                        double idle_timeout,
+                                        std::string replay,
+                                        bool replay_paced,
+                                        int vlen,
+                                        int overlap)
         {
-            return gnuradio::make_block_sptr<bb_series_impl>(center, reflevel, decimation, bandwidth, purge);
+            return gnuradio::make_block_sptr<bb_series_impl>(center, reflevel, decimation, bandwidth, purge, idle_timeout, replay, replay_paced, vlen, overlap);
         }
 
         void ERROR_CHECK(bbStatus status)
@@ -39,10 +56,15 @@ namespace gr {
                                        double reflevel,
                                        int decimation,
                                        double bandwidth,
-                                       bool purge) : 
+                                       bool purge,
+                                       double idle_timeout,
+                                       std::string replay,
+                                       bool replay_paced,
+                                       int vlen,
+                                       int overlap) : 
             gr::sync_block("bb_series",
                            gr::io_signature::make(0, 0, 0),
-                           gr::io_signature::make(1 /* min outputs */, 1 /*max outputs */, sizeof(output_type))),
+                           gr::io_signature::make(1 /* min outputs */, 1 /*max outputs */, sizeof(output_type) * vlen)),
             _handle(-1),
             _center(center),
             _reflevel(reflevel),
@@ -50,17 +72,43 @@ namespace gr {
             _bandwidth(bandwidth),
             _purge(purge),
             _param_changed(true),
-            _buffer(0),
-            _len(0) 
+            _frames(vlen, overlap),
+            _overruns(0),
+            _serial(0),
+            _vrt_samples_per_packet(0),
+            _read_latency(0.002),
+            _output_rate(0.0),
+            _gps_time(false),
+            _io_changed(false),
+            _device_type(BB_DEVICE_BB60C),
+            _tag_config(true),
+            _next_ns(0)
         {
             std::cout << "\nAPI Version: " << bbGetAPIVersion() << "\n";
 
-            // Open device
-            ERROR_CHECK(bbOpenDevice(&_handle));
+            // Open device in the background, start() waits for it
+            if(!replay.empty()) {
+                _open.reset(new device_open("BB60 replay", [this, replay, replay_paced]() {
+                    _replay.reset(new file_device(replay, replay_paced));
+                }));
+            } else {
+                _open.reset(new device_open("BB60", [this]() {
+                    ERROR_CHECK(bbOpenDevice(&_handle));
+
+                    uint32_t serial;
+                    ERROR_CHECK(bbGetSerialNumber(_handle, &serial));
+                    std::cout << "Serial Number: "<< serial << "\n";
+                    _serial = serial;
+                    ERROR_CHECK(bbGetDeviceType(_handle, &_device_type));
+                }));
+            }
+
+            _power.reset(new power_manager([this]() { enter_standby(); },
+                                           [this]() { leave_standby(); }));
+            _power->set_idle_timeout(idle_timeout);
 
-            uint32_t serial;
-            ERROR_CHECK(bbGetSerialNumber(_handle, &serial));
-            std::cout << "Serial Number: "<< serial << "\n";
+            reserve_read_chunk(this, _frames.step());
+            message_port_register_out(pmt::mp("pdus"));
         }
 
         /*
@@ -68,11 +116,11 @@ namespace gr {
          */
         bb_series_impl::~bb_series_impl(void) 
         {
-            bbAbort(_handle);
-            bbCloseDevice(_handle);
-
-            if(_buffer) {
-                delete [] _buffer;
+            _power.reset();
+            _open.reset();
+            if(_handle >= 0) {
+                bbAbort(_handle);
+                bbCloseDevice(_handle);
             }
         }
 
@@ -110,30 +158,289 @@ namespace gr {
             _purge = purge;
         }
 
-        void bb_series_impl::configure()
+        void bb_series_impl::set_idle_timeout(double seconds)
+        {
+            _power->set_idle_timeout(seconds);
+        }
+
+        void bb_series_impl::prewake()
+        {
+            _power->prewake();
+        }
+
+        double bb_series_impl::wake_latency()
+        {
+            return _power->wake_latency();
+        }
+
+        uint64_t bb_series_impl::overruns()
+        {
+            return _overruns;
+        }
+
+        void bb_series_impl::set_vrt_destination(const std::string& destination,
+                                                  int samples_per_packet)
+        {
+            // The stream ID is the serial number. While the device is still
+            // opening, start() sets the sender up instead of waiting here.
+            gr::thread::scoped_lock lock(_mutex);
+            _vrt_destination = destination;
+            _vrt_samples_per_packet = samples_per_packet;
+            _vrt.reset();
+            if(_open->ready()) {
+                apply_vrt_destination();
+            }
+        }
+
+        void bb_series_impl::apply_vrt_destination()
+        {
+            if(!_vrt && !_vrt_destination.empty()) {
+                _vrt.reset(new vrt_sender(_vrt_destination, _vrt_samples_per_packet, _serial));
+            }
+        }
+
+        void bb_series_impl::set_shm_publish(const std::string& name, int capacity)
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            _shm.reset();
+            if(!name.empty()) {
+                _shm.reset(new shm_ring_writer(name, capacity));
+            }
+        }
+
+        void bb_series_impl::set_recording(const std::string& path,
+                                           int mantissa_bits,
+                                           double max_error)
+        {
+            std::unique_ptr<bfp_file_writer> recording;
+            {
+                gr::thread::scoped_lock lock(_mutex);
+                recording.swap(_recording);
+            }
+            // Closing waits for the writer to drain, keep work() running meanwhile
+            recording.reset();
+            if(!path.empty()) {
+                recording.reset(new bfp_file_writer(path, mantissa_bits, max_error));
+                gr::thread::scoped_lock lock(_mutex);
+                _recording.swap(recording);
+            }
+        }
+
+        void bb_series_impl::set_pdu_output(int samples_per_pdu, int pool_size)
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            _pdus.reset();
+            if(samples_per_pdu > 0) {
+                _pdus.reset(new pdu_pool(samples_per_pdu, pool_size, [this](const pmt::pmt_t& pdu) {
+                    message_port_pub(pmt::mp("pdus"), pdu);
+                }));
+            }
+        }
+
+        void bb_series_impl::set_read_latency(double seconds)
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            _read_latency = seconds;
+            _param_changed = true;
+        }
+
+        void bb_series_impl::set_time_source(const std::string& source,
+                                             int com_port,
+                                             int baud_rate)
+        {
+            if(source != "internal" && source != "gps") {
+                throw std::invalid_argument("bb_series: unknown time source " + source);
+            }
+
+            // Reading the GPS takes seconds, keep work() running meanwhile
+            bool gps = false;
+            if(source == "gps") {
+                bbStatus status = bbSyncCPUtoGPS(com_port, baud_rate);
+                if(status < bbNoError) {
+                    std::cout << "** GPS sync failed, using the host clock: "
+                              << bbGetErrorString(status) << " **\n";
+                } else {
+                    gps = true;
+                }
+            }
+
+            gr::thread::scoped_lock lock(_mutex);
+            if(gps != _gps_time) {
+                _gps_time = gps;
+                _io_changed = true;
+                _param_changed = true;
+            }
+        }
+
+        void bb_series_impl::set_output_rate(double rate)
         {
             gr::thread::scoped_lock lock(_mutex);
+            _output_rate = rate;
+            _param_changed = true;
+        }
 
-            // Configure
-            ERROR_CHECK(bbConfigureIQCenter(_handle, _center));
-            ERROR_CHECK(bbConfigureRefLevel(_handle, _reflevel));
-            ERROR_CHECK(bbConfigureIQ(_handle, _decimation, _bandwidth));
-            ERROR_CHECK(bbConfigureIQDataType(_handle, bbDataType32fc));
+        void bb_series_impl::enter_standby()
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            if(_replay || _handle < 0) {
+                return;
+            }
+            bbAbort(_handle);
+            ERROR_CHECK(bbSetPowerState(_handle, bbPowerStateStandby));
+        }
 
-            // Initiate for I/Q streaming
-            ERROR_CHECK(bbInitiate(_handle, BB_STREAMING, BB_STREAM_IQ));
+        void bb_series_impl::leave_standby()
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            if(!_replay && _handle >= 0) {
+                ERROR_CHECK(bbSetPowerState(_handle, bbPowerStateOn));
+            }
+            _param_changed = true;
+        }
 
-            // Get I/Q streaming info
+        bool bb_series_impl::start()
+        {
+            _open->wait();
+            {
+                gr::thread::scoped_lock lock(_mutex);
+                apply_vrt_destination();
+            }
+            _power->active();
+            return bb_series::start();
+        }
+
+        bool bb_series_impl::stop()
+        {
+            // Stop the API streaming threads while the flowgraph is idle,
+            // the next work() reconfigures the device.
+            {
+                gr::thread::scoped_lock lock(_mutex);
+                if(_handle >= 0) {
+                    bbAbort(_handle);
+                }
+                _param_changed = true;
+            }
+            _power->idle();
+            return bb_series::stop();
+        }
+
+        void bb_series_impl::configure()
+        {
+            SH_TRACE("config", "bb_series::configure");
+            gr::thread::scoped_lock lock(_mutex);
+
+            int decimation = _output_rate > 0.0 ? rate_converter::pick_decimation(BASE_RATE, _output_rate, BB_MAX_DECIMATION) : _decimation;
+
+            double center = _center;
             double sampleRate, actualBandwidth;
-            ERROR_CHECK(bbQueryIQParameters(_handle, &sampleRate, &actualBandwidth));
+            if(_replay) {
+                center = _replay->configure(_center, BASE_RATE / decimation, _bandwidth, sampleRate, actualBandwidth);
+            } else {
+                // Configure
+                ERROR_CHECK(bbConfigureIQCenter(_handle, _center));
+                ERROR_CHECK(bbConfigureRefLevel(_handle, _reflevel));
+                ERROR_CHECK(bbConfigureIQ(_handle, decimation, _bandwidth));
+                ERROR_CHECK(bbConfigureIQDataType(_handle, bbDataType32fc));
+
+                if(_io_changed) {
+                    // The PPS arrives on port 2 as a trigger input while on GPS
+                    // time, otherwise the port goes back to its default
+                    bool bb60d = _device_type == BB_DEVICE_BB60D;
+                    uint32_t port1 = bb60d ? BB60D_PORT1_DISABLED : BB60C_PORT1_AC_COUPLED;
+                    uint32_t port2;
+                    if(_gps_time) {
+                        port2 = bb60d ? BB60D_PORT2_IN_TRIG_RISING_EDGE : BB60C_PORT2_IN_TRIG_RISING_EDGE;
+                    } else {
+                        port2 = bb60d ? BB60D_PORT2_DISABLED : BB60C_PORT2_OUT_LOGIC_LOW;
+                    }
+                    bbAbort(_handle); // the ports only change while idle
+                    ERROR_CHECK(bbConfigureIO(_handle, port1, port2));
+                    _io_changed = false;
+                }
+
+                // Initiate for I/Q streaming
+                ERROR_CHECK(bbInitiate(_handle, BB_STREAMING, BB_STREAM_IQ | (_gps_time ? BB_TIME_STAMP : 0)));
+
+                // Get I/Q streaming info
+                ERROR_CHECK(bbQueryIQParameters(_handle, &sampleRate, &actualBandwidth));
+            }
             std::cout << "\nSample Rate: "<< sampleRate << "\n";
             std::cout << "Actual Bandwidth: "<< actualBandwidth << "\n";
+
+            // Finish at the requested rate in software
+            _resampler.reset();
+            if(_output_rate > 0.0) {
+                _resampler.reset(new rate_converter(sampleRate, _output_rate));
+                sampleRate = _output_rate;
+                actualBandwidth = std::min(actualBandwidth, 0.8 * _output_rate);
+            }
+
+            _info.center = center;
+            _info.sample_rate = sampleRate;
+            _info.bandwidth = actualBandwidth;
+            _info.reflevel = _reflevel;
+
+            apply_read_chunk(this, sampleRate, DEVICE_PACKET, _read_latency, _frames.step());
+            _frames.reset();
+
+            _tag_config = true;
+        }
+
+        void bb_series_impl::tag_time(int64_t ns, bool config)
+        {
+            uint64_t offset = nitems_written(0);
+            add_item_tag(0, offset, pmt::mp("rx_time"),
+                         pmt::make_tuple(pmt::from_uint64(ns / 1000000000),
+                                         pmt::from_double((ns % 1000000000) * 1.0e-9)));
+            if(config) {
+                add_item_tag(0, offset, pmt::mp("rx_freq"), pmt::from_double(_info.center));
+                add_item_tag(0, offset, pmt::mp("rx_rate"), pmt::from_double(_info.sample_rate));
+            }
+        }
+
+        void bb_series_impl::read_iq(gr_complex* buf, int n, int64_t& ns_since_epoch, int& loss)
+        {
+            SH_TRACE("device", "bbGetIQUnpacked");
+            if(_replay) {
+                _replay->read(buf, n, _purge, ns_since_epoch, loss);
+                return;
+            }
+            int sec = 0, nano = 0;
+            ERROR_CHECK(bbGetIQUnpacked(_handle, (float *)buf, n, 0, 0, _purge ? BB_TRUE : BB_FALSE, 0, &loss, &sec, &nano));
+            ns_since_epoch = (int64_t)sec * 1000000000 + nano;
+        }
+
+        void bb_series_impl::read_output(gr_complex* buf, int n, int64_t& ns_since_epoch, int& loss)
+        {
+            // Through the resampler when an output rate is set
+            if(!_resampler) {
+                read_iq(buf, n, ns_since_epoch, loss);
+                return;
+            }
+
+            SH_TRACE("convert", "resample");
+            // Time the first output sample from the first read behind it
+            int64_t lead = (int64_t)(_resampler->buffered() * 1.0e9);
+            bool first = true;
+            ns_since_epoch = 0;
+            loss = 0;
+            _resampler->resample(buf, n, [&](gr_complex* in, int m) {
+                int64_t ns = 0;
+                int lost = 0;
+                read_iq(in, m, ns, lost);
+                if(first) {
+                    ns_since_epoch = ns - lead;
+                }
+                first = false;
+                loss |= lost;
+            });
         }
 
         int bb_series_impl::work(int noutput_items,
                                  gr_vector_const_void_star &input_items,
                                  gr_vector_void_star &output_items)
         {
+            SH_TRACE("work", "bb_series::work");
             auto out = static_cast<output_type*>(output_items[0]);
 
             // Initiate new configuration if necessary
@@ -142,19 +449,47 @@ namespace gr {
                 _param_changed = false;
             }
 
-            // Allocate memory if necessary
-            if(!_buffer || noutput_items != _len) {
-                if(_buffer) delete [] _buffer;
-                _buffer = new std::complex<float>[noutput_items];
-                _len = noutput_items;
+            // Get I/Q, whole frames of it when vlen is set
+            int nsamples = 0;
+            int64_t nsSinceEpoch = 0;
+            int sampleLoss = 0;
+            int lead = 0;
+            const gr_complex* samples = _frames.build(out, noutput_items, [this](gr_complex* buf, int n, int64_t& ns, int& loss) {
+                read_output(buf, n, ns, loss);
+            }, nsamples, nsSinceEpoch, sampleLoss, lead);
+
+            if(sampleLoss) {
+                _overruns++;
             }
 
-            // Get I/Q
-            ERROR_CHECK(bbGetIQUnpacked(_handle, (float *)_buffer, noutput_items, 0, 0, _purge ? BB_TRUE : BB_FALSE, 0, 0, 0, 0));
+            // One check per read, the stream is only tagged where its time is discontinuous
+            int64_t tolerance = std::max(TIME_TOLERANCE_NS, (int64_t)(1.0e9 / _info.sample_rate));
+            bool moved = _gps_time && std::llabs(nsSinceEpoch - _next_ns) > tolerance;
+            if(_tag_config || sampleLoss || moved) {
+                // On the first frame, which starts lead samples ahead of the read
+                tag_time(nsSinceEpoch - (int64_t)(lead * 1.0e9 / _info.sample_rate), _tag_config);
+                _tag_config = false;
+            }
+            _next_ns = nsSinceEpoch + (int64_t)(nsamples * 1.0e9 / _info.sample_rate);
 
-            // Move data to output array
-            for(int i = 0; i < noutput_items; i++) {
-                out[i] =  _buffer[i];
+            // Forward to the network, shared memory and disk from here, avoiding a scheduler hop
+            {
+                SH_TRACE("forward", "forward");
+                gr::thread::scoped_lock lock(_mutex);
+                _info.ns_since_epoch = nsSinceEpoch;
+                _info.sample_loss = sampleLoss != 0;
+                if(_vrt) {
+                    _vrt->send(samples, nsamples, _info);
+                }
+                if(_shm) {
+                    _shm->write(samples, nsamples, _info);
+                }
+                if(_recording) {
+                    _recording->write(samples, nsamples, _info);
+                }
+                if(_pdus) {
+                    _pdus->write(samples, nsamples, _info);
+                }
             }
 
             return noutput_items;
@@ -0,0 +1,149 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "bfp_codec.h"
+#include <volk/volk.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace gr {
+namespace signal_hound {
+namespace bfp {
+
+static const size_t BLOCK_HEADER = 2;
+
+static size_t payload_bytes(int bits, size_t samples)
+{
+    return bits == 12 ? samples * 3 : bits == 8 ? samples * 2 : 0;
+}
+
+//! Scale taking values below 2^exponent to the full mantissa range
+static float mantissa_scale(int bits, int exponent)
+{
+    return std::ldexp((float)((1 << (bits - 1)) - 1), -exponent);
+}
+
+size_t max_encoded_size(size_t samples, int block_len)
+{
+    size_t blocks = (samples + block_len - 1) / block_len;
+    return blocks * BLOCK_HEADER + payload_bytes(12, samples);
+}
+
+encoder::encoder(int block_len, int mantissa_bits, double max_error)
+    : _block_len(block_len), _bits(mantissa_bits), _max_error(max_error)
+{
+    if (block_len <= 0) {
+        throw std::invalid_argument("bfp: block length must be positive");
+    }
+    if (mantissa_bits != 8 && mantissa_bits != 12) {
+        throw std::invalid_argument("bfp: mantissa width must be 8 or 12 bits");
+    }
+    _scratch.resize(2 * block_len);
+}
+
+size_t encoder::encode_block(const gr_complex* in, size_t samples, uint8_t* out)
+{
+    // The peak magnitude bounds both I and Q
+    uint32_t index;
+    volk_32fc_index_max_32u(&index, in, samples);
+    float peak = std::abs(in[index]);
+
+    int exponent = 0;
+    std::frexp(peak, &exponent);
+    exponent = std::max(-127, std::min(127, exponent));
+
+    int bits = _bits;
+    if (peak == 0.0f || (_max_error > 0.0 && peak <= _max_error)) {
+        bits = 0;
+    } else if (_max_error > 0.0 &&
+               0.5 / mantissa_scale(8, exponent) <= _max_error) {
+        bits = 8;
+    }
+
+    out[0] = (uint8_t)(int8_t)exponent;
+    out[1] = (uint8_t)bits;
+    uint8_t* payload = out + BLOCK_HEADER;
+    const float* iq = reinterpret_cast<const float*>(in);
+
+    if (bits == 8) {
+        volk_32f_s32f_convert_8i(
+            reinterpret_cast<int8_t*>(payload), iq, mantissa_scale(8, exponent), 2 * samples);
+    } else if (bits == 12) {
+        int16_t* m = &_scratch[0];
+        volk_32f_s32f_convert_16i(m, iq, mantissa_scale(12, exponent), 2 * samples);
+        // I in the low 12 bits of three bytes, Q in the high 12
+        for (size_t i = 0; i < samples; i++) {
+            uint8_t* p = payload + 3 * i;
+            p[0] = m[2 * i];
+            p[1] = ((m[2 * i] >> 8) & 0xf) | (m[2 * i + 1] << 4);
+            p[2] = m[2 * i + 1] >> 4;
+        }
+    }
+
+    return BLOCK_HEADER + payload_bytes(bits, samples);
+}
+
+size_t encoder::encode(const gr_complex* in, size_t samples, uint8_t* out)
+{
+    size_t written = 0;
+    for (size_t i = 0; i < samples; i += _block_len) {
+        written += encode_block(in + i, std::min((size_t)_block_len, samples - i), out + written);
+    }
+    return written;
+}
+
+decoder::decoder(int block_len) : _block_len(block_len) { _scratch.resize(2 * block_len); }
+
+size_t decoder::decode(const uint8_t* in, size_t len, size_t samples, gr_complex* out)
+{
+    size_t consumed = 0;
+    for (size_t i = 0; i < samples; i += _block_len) {
+        size_t n = std::min((size_t)_block_len, samples - i);
+        if (consumed + BLOCK_HEADER > len) {
+            return 0;
+        }
+
+        int exponent = (int8_t)in[consumed];
+        int bits = in[consumed + 1];
+        if (bits != 0 && bits != 8 && bits != 12) {
+            return 0;
+        }
+        const uint8_t* payload = in + consumed + BLOCK_HEADER;
+        consumed += BLOCK_HEADER + payload_bytes(bits, n);
+        if (consumed > len) {
+            return 0;
+        }
+
+        float* iq = reinterpret_cast<float*>(out + i);
+        if (bits == 0) {
+            memset(iq, 0, 2 * n * sizeof(float));
+        } else if (bits == 8) {
+            volk_8i_s32f_convert_32f(iq,
+                                     reinterpret_cast<const int8_t*>(payload),
+                                     mantissa_scale(8, exponent),
+                                     2 * n);
+        } else {
+            // The fields go to the top of each int16 and the conversion
+            // scales the extra 16 back out, sign extending for free
+            uint16_t* m = reinterpret_cast<uint16_t*>(&_scratch[0]);
+            for (size_t k = 0; k < n; k++) {
+                const uint8_t* p = payload + 3 * k;
+                m[2 * k] = (p[0] << 4) | (p[1] << 12);
+                m[2 * k + 1] = ((p[1] & 0xf0) | (p[2] << 8));
+            }
+            volk_16i_s32f_convert_32f(
+                iq, &_scratch[0], 16.0f * mantissa_scale(12, exponent), 2 * n);
+        }
+    }
+    return consumed;
+}
+
+} // namespace bfp
+} // namespace signal_hound
+} // namespace gr
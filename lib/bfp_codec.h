@@ -0,0 +1,89 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_BFP_CODEC_H
+#define INCLUDED_SIGNAL_HOUND_BFP_CODEC_H
+
+#include <gnuradio/gr_complex.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+/*
+ * Block floating point I/Q compression.
+ *
+ * Samples are cut into blocks that share one power-of-two exponent, taken
+ * from the block's peak magnitude, and each I and Q value is stored as a
+ * signed 8 or 12-bit mantissa relative to it. Weak blocks therefore keep
+ * their full mantissa resolution instead of sitting in the low bits of a
+ * fixed-point word.
+ *
+ * Encoded block layout, in bytes:
+ *   0     int8 exponent, the block peak is below 2^exponent
+ *   1     mantissa width: 0 (all zero), 8 or 12
+ *   2...  8-bit: I,Q int8 pairs; 12-bit: I in the low and Q in the high
+ *         12 bits of a little-endian 24-bit word per sample
+ *
+ * The conversions to and from the integer mantissas run through VOLK.
+ */
+namespace bfp {
+
+const int DEFAULT_BLOCK_LEN = 64;
+
+//! Upper bound on encoded bytes for \p samples samples
+size_t max_encoded_size(size_t samples, int block_len);
+
+class encoder
+{
+public:
+    /*!
+     * \param block_len Samples sharing an exponent
+     * \param mantissa_bits 8 or 12
+     * \param max_error When above zero, each block uses the narrowest
+     *        mantissa (0, 8 or up to \p mantissa_bits) whose worst-case
+     *        absolute rounding error stays within this bound
+     */
+    encoder(int block_len = DEFAULT_BLOCK_LEN, int mantissa_bits = 8, double max_error = 0.0);
+
+    //! Encode \p samples samples into \p out, returns bytes written
+    size_t encode(const gr_complex* in, size_t samples, uint8_t* out);
+
+    int block_len() const { return _block_len; }
+
+private:
+    size_t encode_block(const gr_complex* in, size_t samples, uint8_t* out);
+
+    int _block_len;
+    int _bits;
+    double _max_error;
+    std::vector<int16_t> _scratch;
+};
+
+class decoder
+{
+public:
+    explicit decoder(int block_len = DEFAULT_BLOCK_LEN);
+
+    /*!
+     * Decode \p samples samples from \p in, which holds \p len bytes.
+     * Returns bytes consumed, or 0 if the input is truncated or corrupt.
+     */
+    size_t decode(const uint8_t* in, size_t len, size_t samples, gr_complex* out);
+
+private:
+    int _block_len;
+    std::vector<int16_t> _scratch;
+};
+
+} // namespace bfp
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_BFP_CODEC_H */
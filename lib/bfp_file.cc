@@ -0,0 +1,316 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "bfp_file.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+namespace gr {
+namespace signal_hound {
+
+// Largest number of samples stored in one frame
+static const int FRAME_SAMPLES = 65536;
+
+// Samples allowed to wait for the disk, 128 MB of I/Q
+static const size_t QUEUE_SAMPLES = 1 << 24;
+
+bfp_file_writer::bfp_file_writer(const std::string& path,
+                                 int mantissa_bits,
+                                 double max_error,
+                                 int block_len)
+    : _path(path),
+      _file(nullptr),
+      _encoder(block_len, mantissa_bits, max_error),
+      _samples(0),
+      _queued(0),
+      _shutdown(false),
+      _failed(false),
+      _dropping(false),
+      _dropped(0)
+{
+    _file = fopen(path.c_str(), "wb");
+    if (!_file) {
+        throw std::runtime_error("bfp: cannot create " + path + ": " + strerror(errno));
+    }
+    setvbuf(_file, nullptr, _IOFBF, 1 << 20);
+
+    bfp_file_header header;
+    memset(&header, 0, sizeof(header));
+    header.magic = BFP_FILE_MAGIC;
+    header.version = BFP_FILE_VERSION;
+    header.block_len = block_len;
+    header.mantissa_bits = mantissa_bits;
+    header.max_error = max_error;
+    if (fwrite(&header, sizeof(header), 1, _file) != 1) {
+        std::string error = strerror(errno);
+        fclose(_file);
+        throw std::runtime_error("bfp: cannot write " + path + ": " + error);
+    }
+    _offset = sizeof(header);
+
+    _payload.resize(bfp::max_encoded_size(FRAME_SAMPLES, block_len));
+    _thread = std::thread(&bfp_file_writer::run, this);
+
+    std::cout << "Recording " << mantissa_bits << "-bit block floating point I/Q to " << path
+              << std::endl;
+}
+
+bfp_file_writer::~bfp_file_writer()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _shutdown = true;
+    }
+    _cond.notify_one();
+    _thread.join();
+
+    if (!_failed) {
+        bfp_trailer trailer;
+        trailer.index_offset = _offset;
+        trailer.total_samples = _samples;
+        trailer.entries = _index.size();
+        trailer.magic = BFP_TRAILER_MAGIC;
+
+        if (_index.empty() || put(&_index[0], _index.size() * sizeof(bfp_index_entry))) {
+            put(&trailer, sizeof(trailer));
+        }
+    }
+    if (fclose(_file) != 0 && !_failed) {
+        std::cout << "** bfp: cannot finish " << _path << ": " << strerror(errno) << " **"
+                  << std::endl;
+    }
+}
+
+void bfp_file_writer::write(const gr_complex* iq, int len, const stream_info& info)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    if (_failed) {
+        return;
+    }
+    if (_queued + len > QUEUE_SAMPLES) {
+        if (_dropped++ == 0) {
+            std::cout << "** bfp: disk is not keeping up with " << _path
+                      << ", dropping samples **" << std::endl;
+        }
+        _dropping = true;
+        return;
+    }
+
+    chunk c;
+    if (!_spare.empty()) {
+        c = std::move(_spare.back());
+        _spare.pop_back();
+    }
+    lock.unlock();
+
+    c.iq.assign(iq, iq + len);
+    c.info = info;
+
+    lock.lock();
+    if (_dropping) {
+        std::cout << "** bfp: recording resumed after dropping " << _dropped << " reads **"
+                  << std::endl;
+        c.info.sample_loss = true;
+        _dropping = false;
+        _dropped = 0;
+    }
+    _queued += len;
+    _queue.push_back(std::move(c));
+    _cond.notify_one();
+}
+
+void bfp_file_writer::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    for (;;) {
+        _cond.wait(lock, [this] { return _shutdown || !_queue.empty(); });
+        if (_queue.empty()) {
+            break;
+        }
+
+        chunk c = std::move(_queue.front());
+        _queue.pop_front();
+        bool failed = _failed;
+        lock.unlock();
+
+        if (!failed) {
+            write_chunk(c);
+        }
+
+        lock.lock();
+        _queued -= c.iq.size();
+        _spare.push_back(std::move(c));
+    }
+}
+
+bool bfp_file_writer::put(const void* data, size_t bytes)
+{
+    if (fwrite(data, 1, bytes, _file) == bytes) {
+        return true;
+    }
+
+    std::cout << "** bfp: cannot write " << _path << ": " << strerror(errno)
+              << ", recording stopped **" << std::endl;
+    std::lock_guard<std::mutex> lock(_mutex);
+    _failed = true;
+    return false;
+}
+
+void bfp_file_writer::write_chunk(const chunk& c)
+{
+    const gr_complex* iq = c.iq.data();
+    const stream_info& info = c.info;
+    int len = c.iq.size();
+
+    for (int done = 0; done < len;) {
+        int n = std::min(len - done, FRAME_SAMPLES);
+
+        bfp_frame_header frame;
+        frame.magic = BFP_FRAME_MAGIC;
+        frame.samples = n;
+        frame.payload_bytes = _encoder.encode(iq + done, n, &_payload[0]);
+        frame.flags = info.sample_loss && done == 0 ? BFP_FRAME_SAMPLE_LOSS : 0;
+        frame.first_sample = _samples;
+        frame.ns_since_epoch = info.ns_since_epoch;
+        if (info.ns_since_epoch && info.sample_rate > 0.0) {
+            frame.ns_since_epoch += (int64_t)(done * 1.0e9 / info.sample_rate);
+        }
+        frame.center = info.center;
+        frame.sample_rate = info.sample_rate;
+        frame.bandwidth = info.bandwidth;
+        frame.reflevel = info.reflevel;
+
+        if (!put(&frame, sizeof(frame)) || !put(&_payload[0], frame.payload_bytes)) {
+            return;
+        }
+
+        _index.push_back({ _samples, _offset });
+        _offset += sizeof(frame) + frame.payload_bytes;
+        _samples += n;
+        done += n;
+    }
+}
+
+bfp_file_reader::bfp_file_reader(const std::string& path)
+    : _file(nullptr), _total(0), _frame_index(0), _frame_off(0)
+{
+    _file = fopen(path.c_str(), "rb");
+    if (!_file) {
+        throw std::runtime_error("bfp: cannot open " + path + ": " + strerror(errno));
+    }
+
+    bfp_file_header header;
+    if (fread(&header, sizeof(header), 1, _file) != 1 || header.magic != BFP_FILE_MAGIC ||
+        header.version != BFP_FILE_VERSION || header.block_len == 0) {
+        fclose(_file);
+        throw std::runtime_error("bfp: " + path + " is not a block floating point recording");
+    }
+    _decoder = bfp::decoder(header.block_len);
+
+    bfp_trailer trailer;
+    bool indexed = fseeko(_file, -(off_t)sizeof(trailer), SEEK_END) == 0 &&
+                   fread(&trailer, sizeof(trailer), 1, _file) == 1 &&
+                   trailer.magic == BFP_TRAILER_MAGIC;
+    if (indexed) {
+        _index.resize(trailer.entries);
+        _total = trailer.total_samples;
+        indexed = fseeko(_file, trailer.index_offset, SEEK_SET) == 0 &&
+                  (trailer.entries == 0 ||
+                   fread(&_index[0], sizeof(bfp_index_entry), trailer.entries, _file) ==
+                       trailer.entries);
+    }
+    if (!indexed) {
+        std::cout << "bfp: " << path << " has no index, scanning frames" << std::endl;
+        rebuild_index();
+    }
+
+    memset(&_frame, 0, sizeof(_frame));
+    load_frame(0);
+}
+
+bfp_file_reader::~bfp_file_reader() { fclose(_file); }
+
+void bfp_file_reader::rebuild_index()
+{
+    _index.clear();
+    _total = 0;
+
+    off_t offset = sizeof(bfp_file_header);
+    bfp_frame_header frame;
+    while (fseeko(_file, offset, SEEK_SET) == 0 &&
+           fread(&frame, sizeof(frame), 1, _file) == 1 && frame.magic == BFP_FRAME_MAGIC) {
+        // Stop at a frame whose payload was not completely written
+        if (fseeko(_file, offset + sizeof(frame) + frame.payload_bytes - 1, SEEK_SET) != 0 ||
+            fgetc(_file) == EOF) {
+            break;
+        }
+        _index.push_back({ frame.first_sample, (uint64_t)offset });
+        _total = frame.first_sample + frame.samples;
+        offset += sizeof(frame) + frame.payload_bytes;
+    }
+}
+
+bool bfp_file_reader::load_frame(size_t index)
+{
+    if (index >= _index.size() || fseeko(_file, _index[index].offset, SEEK_SET) != 0) {
+        return false;
+    }
+
+    bfp_frame_header frame;
+    if (fread(&frame, sizeof(frame), 1, _file) != 1 || frame.magic != BFP_FRAME_MAGIC) {
+        return false;
+    }
+    _payload.resize(frame.payload_bytes);
+    _decoded.resize(frame.samples);
+    if (fread(_payload.data(), 1, frame.payload_bytes, _file) != frame.payload_bytes ||
+        _decoder.decode(_payload.data(), frame.payload_bytes, frame.samples, _decoded.data()) ==
+            0) {
+        std::cout << "bfp: corrupt frame at sample " << frame.first_sample << std::endl;
+        return false;
+    }
+
+    _frame = frame;
+    _frame_index = index;
+    _frame_off = 0;
+    return true;
+}
+
+bool bfp_file_reader::seek(uint64_t sample)
+{
+    if (sample >= _total) {
+        return false;
+    }
+
+    auto it = std::upper_bound(
+        _index.begin(), _index.end(), sample, [](uint64_t s, const bfp_index_entry& e) {
+            return s < e.first_sample;
+        });
+    size_t index = it - _index.begin() - 1;
+    if (index != _frame_index && !load_frame(index)) {
+        return false;
+    }
+    _frame_off = sample - _frame.first_sample;
+    return true;
+}
+
+int bfp_file_reader::read(gr_complex* out, int len)
+{
+    if (_frame_off >= _frame.samples && !load_frame(_frame_index + 1)) {
+        return 0;
+    }
+
+    int n = std::min((size_t)len, _frame.samples - _frame_off);
+    memcpy(out, &_decoded[_frame_off], n * sizeof(gr_complex));
+    _frame_off += n;
+    return n;
+}
+
+} // namespace signal_hound
+} // namespace gr
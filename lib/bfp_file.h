@@ -0,0 +1,166 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_BFP_FILE_H
+#define INCLUDED_SIGNAL_HOUND_BFP_FILE_H
+
+#include "bfp_codec.h"
+#include "stream_info.h"
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+/*
+ * Recording container for block floating point I/Q.
+ *
+ * A file header is followed by self-describing frames, each holding the
+ * encoded samples of one device read together with the tuning and time of
+ * its first sample. Closing the file appends an index of frame offsets and
+ * a fixed-size trailer pointing at it, which is what makes seeking cheap.
+ * Files cut short without a trailer are still readable; the reader then
+ * rebuilds the index by walking the frames. Fields are in host byte order.
+ *
+ * The writer encodes and writes from its own thread so a slow disk does not
+ * hold up the source. Reads queue up to a bound; past it they are dropped
+ * and the next frame written is flagged with sample loss. A failed write
+ * stops the recording with a warning, keeping what was written so far.
+ */
+
+const uint32_t BFP_FILE_MAGIC = 0x46424853;    // "SHBF"
+const uint32_t BFP_FRAME_MAGIC = 0x314d5246;   // "FRM1"
+const uint32_t BFP_TRAILER_MAGIC = 0x45424853; // "SHBE"
+const uint32_t BFP_FILE_VERSION = 1;
+
+const uint32_t BFP_FRAME_SAMPLE_LOSS = 1;
+
+struct bfp_file_header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t block_len;
+    uint32_t mantissa_bits;
+    double max_error;
+    uint64_t reserved[4];
+};
+
+struct bfp_frame_header {
+    uint32_t magic;
+    uint32_t samples;
+    uint32_t payload_bytes;
+    uint32_t flags;
+    uint64_t first_sample;
+    int64_t ns_since_epoch;
+    double center;
+    double sample_rate;
+    double bandwidth;
+    double reflevel;
+};
+
+struct bfp_index_entry {
+    uint64_t first_sample;
+    uint64_t offset;
+};
+
+struct bfp_trailer {
+    uint64_t index_offset;
+    uint64_t total_samples;
+    uint32_t entries;
+    uint32_t magic;
+};
+
+class bfp_file_writer
+{
+public:
+    bfp_file_writer(const std::string& path,
+                    int mantissa_bits,
+                    double max_error,
+                    int block_len = bfp::DEFAULT_BLOCK_LEN);
+    ~bfp_file_writer();
+
+    //! Queue a read for writing, copying the samples
+    void write(const gr_complex* iq, int len, const stream_info& info);
+
+private:
+    struct chunk {
+        std::vector<gr_complex> iq;
+        stream_info info;
+    };
+
+    void run();
+    void write_chunk(const chunk& c);
+    bool put(const void* data, size_t bytes);
+
+    std::string _path;
+    FILE* _file;
+    bfp::encoder _encoder;
+    std::vector<uint8_t> _payload;
+    std::vector<bfp_index_entry> _index;
+    uint64_t _samples;
+    uint64_t _offset;
+
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    std::thread _thread;
+    std::deque<chunk> _queue;
+    std::vector<chunk> _spare; // drained chunks kept for their buffers
+    size_t _queued;            // samples waiting in _queue
+    bool _shutdown;
+    bool _failed;
+    bool _dropping; // the next queued read follows dropped ones
+    uint64_t _dropped;
+};
+
+class bfp_file_reader
+{
+public:
+    explicit bfp_file_reader(const std::string& path);
+    ~bfp_file_reader();
+
+    //! Total samples in the file
+    uint64_t samples() const { return _total; }
+
+    //! Position the next read() at \p sample, false if past the end
+    bool seek(uint64_t sample);
+
+    /*!
+     * Decode up to \p len samples, never crossing a frame boundary.
+     * Returns the number decoded, 0 at the end of the file.
+     */
+    int read(gr_complex* out, int len);
+
+    //! Absolute index of the next sample read() returns
+    uint64_t position() const { return _frame.first_sample + _frame_off; }
+
+    //! Header of the frame the next sample belongs to
+    const bfp_frame_header& frame() const { return _frame; }
+
+private:
+    bool load_frame(size_t index);
+    void rebuild_index();
+
+    FILE* _file;
+    bfp::decoder _decoder;
+    std::vector<bfp_index_entry> _index;
+    uint64_t _total;
+
+    size_t _frame_index;
+    bfp_frame_header _frame;
+    std::vector<uint8_t> _payload;
+    std::vector<gr_complex> _decoded;
+    size_t _frame_off;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_BFP_FILE_H */
@@ -0,0 +1,102 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "bfp_file_source_impl.h"
+#include <gnuradio/io_signature.h>
+
+namespace gr {
+namespace signal_hound {
+
+using output_type = gr_complex;
+bfp_file_source::sptr bfp_file_source::make(const std::string& filename, bool repeat)
+{
+    return gnuradio::make_block_sptr<bfp_file_source_impl>(filename, repeat);
+}
+
+
+/*
+ * The private constructor
+ */
+bfp_file_source_impl::bfp_file_source_impl(const std::string& filename, bool repeat)
+    : gr::sync_block("bfp_file_source",
+                     gr::io_signature::make(0, 0, 0),
+                     gr::io_signature::make(1 /* min outputs */, 1 /*max outputs */, sizeof(output_type))),
+      _reader(filename),
+      _repeat(repeat),
+      _tag_time(true),
+      _have_tuning(false)
+{
+}
+
+/*
+ * Our virtual destructor.
+ */
+bfp_file_source_impl::~bfp_file_source_impl() {}
+
+bool bfp_file_source_impl::seek(uint64_t sample)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _tag_time = true;
+    return _reader.seek(sample);
+}
+
+uint64_t bfp_file_source_impl::samples()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _reader.samples();
+}
+
+int bfp_file_source_impl::work(int noutput_items,
+                               gr_vector_const_void_star& input_items,
+                               gr_vector_void_star& output_items)
+{
+    auto out = static_cast<output_type*>(output_items[0]);
+    gr::thread::scoped_lock lock(_mutex);
+
+    int produced = 0;
+    while (produced < noutput_items) {
+        int n = _reader.read(out + produced, noutput_items - produced);
+        if (n == 0) {
+            if (_repeat && _reader.seek(0)) {
+                _tag_time = true;
+                continue;
+            }
+            break;
+        }
+
+        const bfp_frame_header& frame = _reader.frame();
+        uint64_t position = _reader.position() - n;
+        uint64_t offset = nitems_written(0) + produced;
+
+        if (!_have_tuning || frame.center != _tagged.center ||
+            frame.sample_rate != _tagged.sample_rate) {
+            add_item_tag(0, offset, pmt::mp("rx_freq"), pmt::from_double(frame.center));
+            add_item_tag(0, offset, pmt::mp("rx_rate"), pmt::from_double(frame.sample_rate));
+            _tagged = frame;
+            _have_tuning = true;
+        }
+
+        bool loss = (frame.flags & BFP_FRAME_SAMPLE_LOSS) && position == frame.first_sample;
+        if ((_tag_time || loss) && frame.ns_since_epoch != 0) {
+            int64_t ns = frame.ns_since_epoch +
+                         (int64_t)((position - frame.first_sample) * 1.0e9 / frame.sample_rate);
+            add_item_tag(0,
+                         offset,
+                         pmt::mp("rx_time"),
+                         pmt::make_tuple(pmt::from_uint64(ns / 1000000000),
+                                         pmt::from_double((ns % 1000000000) * 1.0e-9)));
+        }
+        _tag_time = false;
+
+        produced += n;
+    }
+
+    return produced ? produced : WORK_DONE;
+}
+
+} /* namespace signal_hound */
+} /* namespace gr */
@@ -0,0 +1,44 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_BFP_FILE_SOURCE_IMPL_H
+#define INCLUDED_SIGNAL_HOUND_BFP_FILE_SOURCE_IMPL_H
+
+#include "bfp_file.h"
+#include <gnuradio/signal_hound/bfp_file_source.h>
+
+namespace gr {
+namespace signal_hound {
+
+class bfp_file_source_impl : public bfp_file_source
+{
+private:
+    gr::thread::mutex _mutex;
+    bfp_file_reader _reader;
+    bool _repeat;
+
+    bool _tag_time;
+    bool _have_tuning;
+    bfp_frame_header _tagged;
+    uint64_t _tagged_frame;
+
+public:
+    bfp_file_source_impl(const std::string& filename, bool repeat);
+    ~bfp_file_source_impl();
+
+    bool seek(uint64_t sample);
+    uint64_t samples();
+
+    int work(int noutput_items,
+             gr_vector_const_void_star& input_items,
+             gr_vector_void_star& output_items);
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_BFP_FILE_SOURCE_IMPL_H */
@@ -0,0 +1,43 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "device_open.h"
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+namespace gr {
+namespace signal_hound {
+
+device_open::device_open(const std::string& name, open_fn open)
+{
+    _done = std::async(std::launch::async,
+                       [name, open]() {
+                           auto t0 = std::chrono::steady_clock::now();
+                           open();
+                           double seconds = std::chrono::duration<double>(
+                                                std::chrono::steady_clock::now() - t0)
+                                                .count();
+                           // One write so lines from parallel opens do not interleave
+                           std::ostringstream line;
+                           line << name << " opened in " << seconds << " s\n";
+                           std::cout << line.str() << std::flush;
+                       })
+                .share();
+}
+
+device_open::~device_open() { _done.wait(); }
+
+void device_open::wait() { _done.get(); }
+
+bool device_open::ready() const
+{
+    return _done.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+} // namespace signal_hound
+} // namespace gr
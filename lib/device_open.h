@@ -0,0 +1,50 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_DEVICE_OPEN_H
+#define INCLUDED_SIGNAL_HOUND_DEVICE_OPEN_H
+
+#include <functional>
+#include <future>
+#include <string>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Opens a device on a background thread.
+ *
+ * Opening a device takes seconds, so blocks hand the open to this class
+ * from their constructor and return at once. A flowgraph with several
+ * devices then opens them all at the same time and is ready after the
+ * slowest one rather than after the sum. Anything that needs the handle
+ * calls wait() first. The time each open took is logged.
+ */
+class device_open
+{
+public:
+    typedef std::function<void(void)> open_fn;
+
+    //! Start running \p open, \p name labels the log line
+    device_open(const std::string& name, open_fn open);
+
+    //! Waits for the open to finish
+    ~device_open();
+
+    //! Block until the open has finished, rethrowing anything it threw
+    void wait();
+
+    bool ready() const;
+
+private:
+    std::shared_future<void> _done;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_DEVICE_OPEN_H */
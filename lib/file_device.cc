@@ -0,0 +1,151 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "file_device.h"
+#include <volk/volk.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace gr {
+namespace signal_hound {
+
+// Samples read in ahead of the reader
+static const size_t PREFETCH = 1 << 20;
+// Recordings larger than this are dropped from memory behind the reader
+static const size_t RESIDENT_LIMIT = 256u << 20;
+// Seconds of samples held for a slow reader, about what the devices buffer
+static const double DEVICE_BUFFER = 0.25;
+// Fraction of the rate usable around the center, as for the device filters
+static const double USABLE_BANDWIDTH = 0.8;
+// Retunes leave at least this fraction of the usable band around the center
+static const double MIN_BANDWIDTH = 0.2;
+
+file_device::file_device(const std::string& path, bool paced)
+    : _paced(paced),
+      _pos(0),
+      _rotating(false),
+      _epoch_ns(0),
+      _served(0)
+{
+    sigmf_meta meta = resolve_sample_file(path, "auto");
+    _file.reset(new mapped_file(meta.data_path));
+    _format = meta.format;
+    _total = _file->size() / (_format == SAMPLE_FC32 ? 8 : 4);
+    _rate = meta.sample_rate;
+    _frequency = meta.frequency;
+    _file->prefetch(0, PREFETCH);
+}
+
+double file_device::configure(double center,
+                              double rate,
+                              double bandwidth,
+                              double& actual_rate,
+                              double& actual_bandwidth)
+{
+    if (_rate <= 0.0) {
+        _rate = rate;
+    }
+    if (_frequency <= 0.0) {
+        _frequency = center;
+    }
+    if (rate != _rate) {
+        std::cout << "** Replay runs at the recorded " << _rate << " S/s, not " << rate
+                  << " **" << std::endl;
+    }
+
+    double limit = (1.0 - MIN_BANDWIDTH) * USABLE_BANDWIDTH * _rate / 2.0;
+    double offset = std::max(-limit, std::min(limit, center - _frequency));
+    if (offset != center - _frequency) {
+        std::cout << "** Replay cannot tune to " << center << " Hz, outside the recorded span **"
+                  << std::endl;
+    }
+    _rotator.set_phase(gr_complex(1.0f, 0.0f));
+    _rotator.set_phase_incr(std::polar(1.0f, (float)(-2.0 * M_PI * offset / _rate)));
+    _rotating = offset != 0.0;
+
+    actual_rate = _rate;
+    actual_bandwidth = std::min(bandwidth, USABLE_BANDWIDTH * _rate - 2.0 * std::abs(offset));
+    if (actual_bandwidth <= 0.0) {
+        actual_bandwidth = USABLE_BANDWIDTH * _rate - 2.0 * std::abs(offset);
+    }
+
+    // Streaming restarts from here
+    _t0 = clock::now();
+    _epoch_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::system_clock::now().time_since_epoch())
+                    .count();
+    _served = 0;
+    return _frequency + offset;
+}
+
+void file_device::copy(gr_complex* buf, int n)
+{
+    const size_t sample_bytes = _format == SAMPLE_FC32 ? 8 : 4;
+    const bool release = _total * sample_bytes > RESIDENT_LIMIT;
+
+    int done = 0;
+    while (done < n) {
+        int len = (int)std::min((uint64_t)(n - done), _total - _pos);
+        const uint8_t* src = _file->data() + _pos * sample_bytes;
+        if (_format == SAMPLE_FC32) {
+            memcpy(buf + done, src, len * sizeof(gr_complex));
+        } else {
+            volk_16i_s32f_convert_32f(reinterpret_cast<float*>(buf + done),
+                                      reinterpret_cast<const int16_t*>(src),
+                                      32768.0f,
+                                      2 * len);
+        }
+        if (release && _pos >= PREFETCH) {
+            _file->release((_pos - PREFETCH) * sample_bytes, len * sample_bytes);
+        }
+
+        done += len;
+        _pos += len;
+        if (_pos == _total) {
+            _pos = 0;
+        }
+        _file->prefetch(_pos * sample_bytes, PREFETCH * sample_bytes);
+    }
+
+    if (_rotating) {
+        _rotator.rotateN(buf, buf, n);
+    }
+}
+
+void file_device::read(gr_complex* buf, int n, bool purge, int64_t& ns_since_epoch, int& loss)
+{
+    loss = 0;
+    if (_paced) {
+        double now = std::chrono::duration<double>(clock::now() - _t0).count();
+        double behind = now - _served / _rate;
+        double held = purge ? 0.0 : DEVICE_BUFFER;
+        if (behind > held) {
+            // Samples that overflowed the buffer, or all of them on a purge
+            uint64_t skip = (uint64_t)((behind - held) * _rate);
+            _pos = (_pos + skip) % _total;
+            _served += skip;
+            loss = !purge;
+        }
+    }
+
+    ns_since_epoch = _epoch_ns + (int64_t)(_served * 1.0e9 / _rate);
+    copy(buf, n);
+    _served += n;
+
+    if (_paced) {
+        // Block until the last sample would have come in
+        std::this_thread::sleep_until(
+            _t0 + std::chrono::duration_cast<clock::duration>(
+                      std::chrono::duration<double>(_served / _rate)));
+    }
+}
+
+} // namespace signal_hound
+} // namespace gr
@@ -0,0 +1,88 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_FILE_DEVICE_H
+#define INCLUDED_SIGNAL_HOUND_FILE_DEVICE_H
+
+#include "mapped_file.h"
+#include "sigmf_meta.h"
+#include <gnuradio/blocks/rotator.h>
+#include <gnuradio/gr_complex.h>
+#include <chrono>
+#include <memory>
+#include <string>
+
+namespace gr {
+namespace signal_hound {
+
+/*
+ * Stands in for a receiver by serving a recording, SigMF or raw, to the
+ * I/Q reads of a source block, so the tagging, loss handling and retune
+ * code of the source runs as it would against hardware.
+ *
+ * Paced, the recording plays out in real time: reads block until their
+ * samples would have arrived, and a reader that falls more than a device
+ * buffer behind loses the excess and is told so, as with a real device.
+ * Unpaced, reads return at once for throughput testing. Timestamps count
+ * samples from the time streaming started either way.
+ *
+ * The recording always plays at its own rate. Retunes within the recorded
+ * span are made by shifting the samples digitally; the band left usable
+ * narrows with the shift. The recording loops with its timestamps running
+ * on, so the seam is not reported as loss.
+ * A raw file records neither rate nor frequency, so it is taken to have
+ * been made at the settings of the first configure().
+ */
+class file_device
+{
+public:
+    file_device(const std::string& path, bool paced);
+
+    /*!
+     * Tune to \p center, or the nearest frequency the recording covers,
+     * and restart streaming. \p rate and \p bandwidth are what the source
+     * asked the device for. Returns the center tuned to and fills in the
+     * actual rate and usable bandwidth.
+     */
+    double configure(double center,
+                     double rate,
+                     double bandwidth,
+                     double& actual_rate,
+                     double& actual_bandwidth);
+
+    /*!
+     * Read \p n samples, giving the time of the first and whether any were
+     * lost before them. \p purge drops whatever a slow reader left behind.
+     */
+    void read(gr_complex* buf, int n, bool purge, int64_t& ns_since_epoch, int& loss);
+
+private:
+    typedef std::chrono::steady_clock clock;
+
+    void copy(gr_complex* buf, int n);
+
+    std::unique_ptr<mapped_file> _file;
+    sample_format _format;
+    uint64_t _total;
+    double _rate;
+    double _frequency;
+    bool _paced;
+
+    uint64_t _pos;
+    gr::blocks::rotator _rotator;
+    bool _rotating;
+
+    // Streaming started at _t0, _epoch_ns on the system clock
+    clock::time_point _t0;
+    int64_t _epoch_ns;
+    uint64_t _served;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_FILE_DEVICE_H */
@@ -0,0 +1,91 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "frame_builder.h"
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+namespace gr {
+namespace signal_hound {
+
+frame_builder::frame_builder(int vlen, int overlap)
+    : _vlen(vlen), _overlap(overlap), _primed(false), _tail(0)
+{
+    if (vlen < 1) {
+        throw std::invalid_argument("frame_builder: vlen must be at least 1");
+    }
+    if (overlap < 0 || overlap >= vlen) {
+        throw std::invalid_argument("frame_builder: overlap " + std::to_string(overlap) +
+                                    " must be below vlen " + std::to_string(vlen));
+    }
+}
+
+void frame_builder::reset() { _primed = false; }
+
+const gr_complex* frame_builder::build(gr_complex* out,
+                                       int nframes,
+                                       const read_fn& read,
+                                       int& nsamples,
+                                       int64_t& ns_since_epoch,
+                                       int& loss,
+                                       int& lead)
+{
+    const int step = _vlen - _overlap;
+    nsamples = nframes * step;
+    lead = 0;
+
+    if (_overlap == 0) {
+        read(out, nsamples, ns_since_epoch, loss);
+        return out;
+    }
+
+    // Room for the tail, the new samples and a fresh first frame after a gap
+    size_t size = 2 * _overlap + nsamples;
+    if (_stage.size() < size) {
+        _stage.resize(size);
+    }
+
+    if (_primed) {
+        // The tail of the last frame opens the next one
+        memmove(&_stage[0], &_stage[_tail], _overlap * sizeof(gr_complex));
+    }
+
+    gr_complex* fresh = &_stage[_primed ? _overlap : 0];
+    int first = 0;
+    if (!_primed) {
+        nsamples += _overlap;
+        read(fresh, nsamples, ns_since_epoch, loss);
+    } else {
+        read(fresh, nsamples, ns_since_epoch, loss);
+        if (loss) {
+            // The tail is from before the gap, read the first frame anew
+            int64_t ns = 0;
+            int more = 0;
+            read(fresh + nsamples, _overlap, ns, more);
+            loss |= more;
+            nsamples += _overlap;
+            first = _overlap;
+        } else {
+            lead = _overlap;
+        }
+    }
+
+    for (int f = 0; f < nframes; f++) {
+        memcpy(out + (size_t)f * _vlen,
+               &_stage[first + (size_t)f * step],
+               _vlen * sizeof(gr_complex));
+    }
+
+    // Moved to the front on the next call, the new samples stay put till then
+    _tail = first + (size_t)nframes * step;
+    _primed = true;
+    return fresh;
+}
+
+} // namespace signal_hound
+} // namespace gr
@@ -0,0 +1,74 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_FRAME_BUILDER_H
+#define INCLUDED_SIGNAL_HOUND_FRAME_BUILDER_H
+
+#include <gnuradio/gr_complex.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+/*
+ * Cuts the device stream of a source into output frames of vlen samples,
+ * consecutive frames starting step = vlen - overlap samples apart.
+ *
+ * Without overlap the device reads straight into the output buffer, whole
+ * frames at a time, so a scalar source pays nothing for it. With overlap
+ * the new samples are read in behind the tail of the previous frame and the
+ * frames are copied out from there.
+ *
+ * Framing restarts on the first sample of a read after reset() or a read
+ * reporting loss, so a frame never spans a retune or a gap and the first
+ * frame after one starts exactly on the read timestamp.
+ */
+class frame_builder
+{
+public:
+    //! Reads exactly \p n samples, giving the time of the first and any loss
+    typedef std::function<void(gr_complex* buf, int n, int64_t& ns_since_epoch, int& loss)>
+        read_fn;
+
+    frame_builder(int vlen, int overlap);
+
+    int vlen() const { return _vlen; }
+    int step() const { return _vlen - _overlap; }
+
+    //! Start the next frame on a fresh read, call on reconfiguration
+    void reset();
+
+    /*!
+     * Fill \p nframes frames at \p out. Returns the samples newly read, in
+     * order and \p nsamples of them, for forwarding. \p ns_since_epoch is
+     * the time of the first of them and the first frame starts \p lead
+     * samples earlier. The samples stay valid until the next call.
+     */
+    const gr_complex* build(gr_complex* out,
+                            int nframes,
+                            const read_fn& read,
+                            int& nsamples,
+                            int64_t& ns_since_epoch,
+                            int& loss,
+                            int& lead);
+
+private:
+    int _vlen;
+    int _overlap;
+    bool _primed;
+    size_t _tail;
+
+    std::vector<gr_complex> _stage; // tail of the last frame followed by new samples
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_FRAME_BUILDER_H */
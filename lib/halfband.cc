@@ -0,0 +1,105 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "halfband.h"
+#include <volk/volk.h>
+#include <algorithm>
+#include <cmath>
+
+namespace gr {
+namespace signal_hound {
+
+std::vector<float> halfband_taps(int ntaps, float gain)
+{
+    ntaps = std::max(3, (ntaps + 4) / 4 * 4 - 1);
+    int mid = ntaps / 2;
+    std::vector<float> taps(ntaps, 0.0f);
+    for (int i = 0; i < ntaps; i++) {
+        int n = i - mid;
+        double sinc = n == 0 ? 1.0 : (n % 2 ? std::sin(M_PI * n / 2.0) / (M_PI * n / 2.0) : 0.0);
+        // Window over ntaps + 2 points without its zero endpoints
+        double x = (double)(i + 1) / (ntaps + 1);
+        double blackman = 0.42 - 0.5 * std::cos(2.0 * M_PI * x) + 0.08 * std::cos(4.0 * M_PI * x);
+        taps[i] = (float)(0.5 * gain * sinc * blackman);
+    }
+    return taps;
+}
+
+halfband_decimator::halfband_decimator(int ntaps)
+{
+    std::vector<float> taps = halfband_taps(ntaps);
+    _mid = taps.size() / 2;
+    _center = taps[_mid];
+
+    // Taps at even indices, reversed to run forward over the phase array
+    for (int t = taps.size() - 1; t >= 0; t -= 2) {
+        _taps.push_back(taps[t]);
+    }
+    reset();
+}
+
+void halfband_decimator::reset()
+{
+    _buf.assign(2 * _mid, 0.0f);
+    _count = 0;
+}
+
+int halfband_decimator::decimate(const gr_complex* in, int n, gr_complex* out)
+{
+    int history = 2 * _mid;
+    _buf.resize(history + n);
+    std::copy(in, in + n, _buf.begin() + history);
+
+    // Outputs fall on the inputs with an even stream index, at buffer
+    // indices q = first + 2m. The side taps only meet samples of q's
+    // phase, gathered here so each output is one contiguous dot product.
+    int first = history + (int)(_count & 1);
+    int phase = first & 1;
+    _phase.resize((_buf.size() - phase + 1) / 2);
+    for (size_t k = 0; k < _phase.size(); k++) {
+        _phase[k] = _buf[2 * k + phase];
+    }
+
+    int outputs = (history + n - first + 1) / 2;
+    for (int m = 0; m < outputs; m++) {
+        int q = first + 2 * m;
+        gr_complex side;
+        volk_32fc_32f_dot_prod_32fc(&side, &_phase[(q - history) / 2], _taps.data(), _taps.size());
+        out[m] = side + _center * _buf[q - _mid];
+    }
+
+    std::copy(_buf.end() - history, _buf.end(), _buf.begin());
+    _buf.resize(history);
+    _count += n;
+    return outputs;
+}
+
+halfband_pyramid::halfband_pyramid(int levels, int ntaps)
+    : _stages(levels, halfband_decimator(ntaps)), _out(levels), _count(levels, 0)
+{
+}
+
+void halfband_pyramid::reset()
+{
+    for (auto& stage : _stages) {
+        stage.reset();
+    }
+}
+
+void halfband_pyramid::process(const gr_complex* in, int n, int levels)
+{
+    levels = std::min(levels, (int)_stages.size());
+    for (int l = 0; l < levels; l++) {
+        _out[l].resize(n / 2 + 1);
+        _count[l] = _stages[l].decimate(in, n, _out[l].data());
+        in = _out[l].data();
+        n = _count[l];
+    }
+}
+
+} // namespace signal_hound
+} // namespace gr
@@ -0,0 +1,79 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_HALFBAND_H
+#define INCLUDED_SIGNAL_HOUND_HALFBAND_H
+
+#include <gnuradio/gr_complex.h>
+#include <cstdint>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * Blackman windowed sinc half-band low pass, cutoff at a quarter of the
+ * rate. The length is rounded up to 4k-1 so the end taps fall on sinc
+ * lobes, and the window leaves out its zero endpoints, so they are
+ * non-zero; every other tap but the center is zero.
+ */
+std::vector<float> halfband_taps(int ntaps, float gain = 1.0f);
+
+/*
+ * Decimate-by-two half-band filter with state carried across calls.
+ *
+ * Only the non-zero taps are evaluated: the input is split into its two
+ * sample phases, one phase meets the center tap alone and the other the
+ * remaining taps as one contiguous VOLK dot product per output.
+ */
+class halfband_decimator
+{
+public:
+    explicit halfband_decimator(int ntaps);
+
+    //! Filter \p n samples, returns the outputs written, about n / 2
+    int decimate(const gr_complex* in, int n, gr_complex* out);
+
+    void reset();
+
+private:
+    std::vector<float> _taps;   // non-zero side taps, reversed
+    float _center;
+    int _mid;
+
+    std::vector<gr_complex> _buf;   // history followed by new input
+    std::vector<gr_complex> _phase; // the samples meeting the side taps
+    uint64_t _count;
+};
+
+/*
+ * Cascade of half-band decimators, level l running at 1/2^l of the input.
+ * Each level feeds the next, so coarser levels reuse the work of finer
+ * ones, and process() stops at the deepest level asked for.
+ */
+class halfband_pyramid
+{
+public:
+    halfband_pyramid(int levels, int ntaps);
+
+    void process(const gr_complex* in, int n, int levels);
+
+    const gr_complex* level(int l) const { return _out[l - 1].data(); }
+    int count(int l) const { return _count[l - 1]; }
+
+    void reset();
+
+private:
+    std::vector<halfband_decimator> _stages;
+    std::vector<std::vector<gr_complex>> _out;
+    std::vector<int> _count;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_HALFBAND_H */
@@ -0,0 +1,65 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "latency_marker.h"
+#include <cmath>
+
+namespace gr {
+namespace signal_hound {
+
+// Injections remembered without a matching detection
+static const size_t MAX_PENDING = 1024;
+
+std::mutex latency_marker::s_mutex;
+std::deque<latency_marker::clock::time_point> latency_marker::s_injected;
+
+std::vector<gr_complex>
+latency_marker::make_chirp(double sample_rate, double bandwidth, double duration)
+{
+    size_t len = std::max(1.0, std::round(duration * sample_rate));
+    std::vector<gr_complex> chirp(len);
+
+    // Instantaneous frequency -B/2 + (B/T) t
+    double slope = bandwidth / duration;
+    for (size_t i = 0; i < len; i++) {
+        double t = i / sample_rate;
+        double phase = 2.0 * M_PI * (-0.5 * bandwidth * t + 0.5 * slope * t * t);
+        chirp[i] = gr_complex(std::cos(phase), std::sin(phase));
+    }
+    return chirp;
+}
+
+void latency_marker::injected(clock::time_point when)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+    s_injected.push_back(when);
+    if (s_injected.size() > MAX_PENDING) {
+        s_injected.pop_front();
+    }
+}
+
+bool latency_marker::detected(clock::time_point when, double& latency)
+{
+    std::lock_guard<std::mutex> lock(s_mutex);
+
+    // Markers injected before the latest one that precedes this detection
+    // were missed by the receiver
+    bool found = false;
+    clock::time_point sent;
+    while (!s_injected.empty() && s_injected.front() <= when) {
+        sent = s_injected.front();
+        s_injected.pop_front();
+        found = true;
+    }
+    if (found) {
+        latency = std::chrono::duration<double>(when - sent).count();
+    }
+    return found;
+}
+
+} // namespace signal_hound
+} // namespace gr
@@ -0,0 +1,59 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_LATENCY_MARKER_H
+#define INCLUDED_SIGNAL_HOUND_LATENCY_MARKER_H
+
+#include <gnuradio/gr_complex.h>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+/*
+ * Loopback latency markers.
+ *
+ * The generator inserts a linear chirp of known bandwidth and duration.
+ * Because the chirp is defined in time rather than in samples, the
+ * receiver can rebuild its own copy at a different sample rate, and a
+ * small frequency offset between the two ends only shifts the correlation
+ * peak by a negligible amount.
+ *
+ * Injection times are kept in a process-wide registry. Each detection is
+ * paired with the most recent injection before it, so markers must be sent
+ * further apart than the largest latency being measured.
+ */
+class latency_marker
+{
+public:
+    typedef std::chrono::steady_clock clock;
+
+    //! Unit amplitude chirp sweeping -bandwidth/2 to +bandwidth/2
+    static std::vector<gr_complex>
+    make_chirp(double sample_rate, double bandwidth, double duration);
+
+    //! Note that a marker is being handed to the generator hardware now
+    static void injected(clock::time_point when = clock::now());
+
+    /*!
+     * Pair a detection with its injection. Returns false when no marker
+     * has been injected since the previous detection.
+     */
+    static bool detected(clock::time_point when, double& latency);
+
+private:
+    static std::mutex s_mutex;
+    static std::deque<clock::time_point> s_injected;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_LATENCY_MARKER_H */
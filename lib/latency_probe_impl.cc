@@ -0,0 +1,196 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "latency_probe_impl.h"
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <limits>
+
+namespace gr {
+namespace signal_hound {
+
+using input_type = gr_complex;
+latency_probe::sptr latency_probe::make(double sample_rate,
+                                        double bandwidth,
+                                        double duration,
+                                        double threshold,
+                                        double bin_width,
+                                        int bins)
+{
+    return gnuradio::make_block_sptr<latency_probe_impl>(
+        sample_rate, bandwidth, duration, threshold, bin_width, bins);
+}
+
+
+/*
+ * The private constructor
+ */
+latency_probe_impl::latency_probe_impl(double sample_rate,
+                                       double bandwidth,
+                                       double duration,
+                                       double threshold,
+                                       double bin_width,
+                                       int bins)
+    : gr::sync_block("latency_probe",
+                     gr::io_signature::make(1 /* min inputs */, 1 /* max inputs */, sizeof(input_type)),
+                     gr::io_signature::make(0, 0, 0)),
+      _threshold(threshold),
+      _power_pos(0),
+      _window_energy(0.0),
+      _in_peak(false),
+      _peak_metric(0.0f),
+      _since_peak(0),
+      _bin_width(bin_width),
+      _histogram(std::max(1, bins), 0)
+{
+    // Matched filter: the conjugated, time reversed marker
+    std::vector<gr_complex> taps = latency_marker::make_chirp(sample_rate, bandwidth, duration);
+    _marker_len = taps.size();
+    _marker_energy = _marker_len;
+    std::reverse(taps.begin(), taps.end());
+    for (auto& t : taps) {
+        t = std::conj(t);
+    }
+    _correlator.reset(new gr::filter::kernel::fft_filter_ccc(1, taps));
+    _power.assign(_marker_len, 0.0f);
+
+    // The filter reads and writes whole FFT blocks, set_taps() gives their size
+    const int nsamples = _correlator->set_taps(taps);
+    set_output_multiple(nsamples);
+    _correlation.resize(nsamples);
+
+    message_port_register_out(pmt::mp("latency"));
+    reset();
+}
+
+/*
+ * Our virtual destructor.
+ */
+latency_probe_impl::~latency_probe_impl() {}
+
+void latency_probe_impl::record(double latency)
+{
+    size_t bin = std::min(_histogram.size() - 1, (size_t)(latency / _bin_width));
+    _histogram[bin]++;
+    _detections++;
+    _sum += latency;
+    _min = std::min(_min, latency);
+    _max = std::max(_max, latency);
+}
+
+std::vector<uint64_t> latency_probe_impl::histogram()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _histogram;
+}
+
+double latency_probe_impl::bin_width() { return _bin_width; }
+
+uint64_t latency_probe_impl::detections()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _detections;
+}
+
+uint64_t latency_probe_impl::unmatched()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _unmatched;
+}
+
+double latency_probe_impl::min_latency()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _detections ? _min : 0.0;
+}
+
+double latency_probe_impl::mean_latency()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _detections ? _sum / _detections : 0.0;
+}
+
+double latency_probe_impl::max_latency()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _max;
+}
+
+void latency_probe_impl::reset()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    std::fill(_histogram.begin(), _histogram.end(), 0);
+    _detections = 0;
+    _unmatched = 0;
+    _min = std::numeric_limits<double>::max();
+    _sum = 0.0;
+    _max = 0.0;
+}
+
+bool latency_probe_impl::stop()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    if (_detections) {
+        std::cout << "Loopback latency over " << _detections << " markers: min "
+                  << _min * 1e3 << " ms, mean " << _sum / _detections * 1e3 << " ms, max "
+                  << _max * 1e3 << " ms" << std::endl;
+    }
+    return latency_probe::stop();
+}
+
+int latency_probe_impl::work(int noutput_items,
+                             gr_vector_const_void_star& input_items,
+                             gr_vector_void_star& output_items)
+{
+    auto in = static_cast<const input_type*>(input_items[0]);
+
+    // Everything in this call arrived by now
+    auto now = latency_marker::clock::now();
+
+    if (_correlation.size() < (size_t)noutput_items) {
+        _correlation.resize(noutput_items);
+    }
+    _correlator->filter(noutput_items, in, &_correlation[0]);
+
+    gr::thread::scoped_lock lock(_mutex);
+    for (int i = 0; i < noutput_items; i++) {
+        float p = std::norm(in[i]);
+        _window_energy += p - _power[_power_pos];
+        _power[_power_pos] = p;
+        if (++_power_pos == _marker_len) {
+            // Recompute to keep rounding from accumulating
+            _power_pos = 0;
+            _window_energy = 0.0;
+            for (float q : _power) {
+                _window_energy += q;
+            }
+        }
+
+        float metric = std::norm(_correlation[i]) / (_marker_energy * _window_energy + 1e-20);
+        if (metric > _threshold && (!_in_peak || metric > _peak_metric)) {
+            _in_peak = true;
+            _peak_metric = metric;
+            _peak_time = now;
+            _since_peak = 0;
+        } else if (_in_peak && ++_since_peak > _marker_len) {
+            // No stronger peak within a marker length, this one is it
+            _in_peak = false;
+            double latency;
+            if (latency_marker::detected(_peak_time, latency)) {
+                record(latency);
+                message_port_pub(pmt::mp("latency"), pmt::from_double(latency));
+            } else {
+                _unmatched++;
+            }
+        }
+    }
+
+    return noutput_items;
+}
+
+} /* namespace signal_hound */
+} /* namespace gr */
@@ -0,0 +1,76 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_LATENCY_PROBE_IMPL_H
+#define INCLUDED_SIGNAL_HOUND_LATENCY_PROBE_IMPL_H
+
+#include "latency_marker.h"
+#include <gnuradio/filter/fft_filter.h>
+#include <gnuradio/signal_hound/latency_probe.h>
+#include <memory>
+
+namespace gr {
+namespace signal_hound {
+
+class latency_probe_impl : public latency_probe
+{
+private:
+    gr::thread::mutex _mutex;
+
+    std::unique_ptr<gr::filter::kernel::fft_filter_ccc> _correlator;
+    std::vector<gr_complex> _correlation;
+    size_t _marker_len;
+    double _marker_energy;
+    float _threshold;
+
+    // Input energy over the last marker length
+    std::vector<float> _power;
+    size_t _power_pos;
+    double _window_energy;
+
+    bool _in_peak;
+    float _peak_metric;
+    size_t _since_peak;
+    latency_marker::clock::time_point _peak_time;
+
+    double _bin_width;
+    std::vector<uint64_t> _histogram;
+    uint64_t _detections;
+    uint64_t _unmatched;
+    double _min, _sum, _max;
+
+    void record(double latency);
+
+public:
+    latency_probe_impl(double sample_rate,
+                       double bandwidth,
+                       double duration,
+                       double threshold,
+                       double bin_width,
+                       int bins);
+    ~latency_probe_impl();
+
+    std::vector<uint64_t> histogram();
+    double bin_width();
+    uint64_t detections();
+    uint64_t unmatched();
+    double min_latency();
+    double mean_latency();
+    double max_latency();
+    void reset();
+
+    bool stop();
+
+    int work(int noutput_items,
+             gr_vector_const_void_star& input_items,
+             gr_vector_void_star& output_items);
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_LATENCY_PROBE_IMPL_H */
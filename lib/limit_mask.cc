@@ -0,0 +1,185 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "limit_mask.h"
+#include <volk/volk.h>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace gr {
+namespace signal_hound {
+
+// Bins per tile of the compare, 4 kB of floats
+static const size_t TILE = 1024;
+static const size_t NO_PEAK = std::numeric_limits<size_t>::max();
+
+limit_mask::limit_mask(double threshold)
+    : _threshold(threshold), _changed(true), _start_freq(0.0), _bin_size(0.0)
+{
+}
+
+void limit_mask::set_threshold(double threshold)
+{
+    _threshold = threshold;
+    _changed = true;
+}
+
+void limit_mask::set_points(const std::vector<double>& freqs, const std::vector<double>& levels)
+{
+    if (freqs.size() != levels.size()) {
+        throw std::invalid_argument("limit_mask: mask needs a level per frequency");
+    }
+    if (!std::is_sorted(freqs.begin(), freqs.end())) {
+        throw std::invalid_argument("limit_mask: mask frequencies must ascend");
+    }
+    _freqs = freqs;
+    _levels = levels;
+    _changed = true;
+}
+
+const float* limit_mask::line(const sweep_trace& sweep)
+{
+    if (!_changed && sweep.start_freq == _start_freq && sweep.bin_size == _bin_size &&
+        sweep.bins.size() == _line.size()) {
+        return _line.data();
+    }
+
+    _line.resize(sweep.bins.size());
+    for (size_t i = 0; i < _line.size(); i++) {
+        double f = sweep.freq(i);
+        if (_freqs.empty()) {
+            _line[i] = _threshold;
+        } else if (f <= _freqs.front()) {
+            _line[i] = _levels.front();
+        } else if (f >= _freqs.back()) {
+            _line[i] = _levels.back();
+        } else {
+            size_t k = std::upper_bound(_freqs.begin(), _freqs.end(), f) - _freqs.begin();
+            double t = (f - _freqs[k - 1]) / (_freqs[k] - _freqs[k - 1]);
+            _line[i] = _levels[k - 1] + t * (_levels[k] - _levels[k - 1]);
+        }
+    }
+    _start_freq = sweep.start_freq;
+    _bin_size = sweep.bin_size;
+    _changed = false;
+    return _line.data();
+}
+
+mask_compare::mask_compare(float hysteresis, float floor, float excursion)
+    : _hysteresis(hysteresis)
+{
+    set_peaks(floor, excursion);
+}
+
+void mask_compare::set_peaks(float floor, float excursion)
+{
+    if (excursion <= 0.0f) {
+        throw std::invalid_argument("mask_compare: peak excursion must be positive");
+    }
+    _floor = floor;
+    _excursion = excursion;
+}
+
+void mask_compare::process(const float* trace, const float* limit, size_t n)
+{
+    _violations.clear();
+    _peaks.clear();
+    _excess.resize(n);
+
+    // Violation state
+    bool open = false;
+    mask_run run = { 0, 0, 0, 0.0f };
+    // Peak state, either climbing towards a peak or descending into a valley
+    bool climbing = true;
+    float high = 0.0f, low = 0.0f;
+    size_t high_bin = NO_PEAK;
+
+    for (size_t i = 0; i < n; i += TILE) {
+        const unsigned int len = std::min(TILE, n - i);
+        float* excess = &_excess[i];
+        volk_32f_x2_subtract_32f(excess, trace + i, limit + i, len);
+
+        uint32_t max_excess, max_level;
+        volk_32f_index_max_32u(&max_excess, excess, len);
+        volk_32f_index_max_32u(&max_level, trace + i, len);
+        if (!open && excess[max_excess] <= 0.0f && trace[i + max_level] < _floor) {
+            // Below the floor everywhere, which is a valley
+            if (climbing && high_bin != NO_PEAK) {
+                _peaks.push_back(high_bin);
+            }
+            climbing = true;
+            high_bin = NO_PEAK;
+            continue;
+        }
+
+        for (unsigned int k = 0; k < len; k++) {
+            const size_t bin = i + k;
+            const float e = excess[k];
+            const float v = trace[bin];
+
+            if (e > 0.0f) {
+                if (!open) {
+                    open = true;
+                    run = { bin, bin, bin, e };
+                }
+                run.last = bin;
+                if (e > run.excess) {
+                    run.peak = bin;
+                    run.excess = e;
+                }
+            } else if (open && e < -_hysteresis) {
+                _violations.push_back(run);
+                open = false;
+            }
+
+            if (v < _floor) {
+                if (climbing && high_bin != NO_PEAK) {
+                    _peaks.push_back(high_bin);
+                }
+                climbing = true;
+                high_bin = NO_PEAK;
+            } else if (climbing) {
+                if (high_bin == NO_PEAK || v > high) {
+                    high = v;
+                    high_bin = bin;
+                } else if (v < high - _excursion) {
+                    _peaks.push_back(high_bin);
+                    climbing = false;
+                    low = v;
+                }
+            } else if (v < low) {
+                low = v;
+            } else if (v > low + _excursion) {
+                climbing = true;
+                high = v;
+                high_bin = bin;
+            }
+        }
+    }
+
+    if (open) {
+        _violations.push_back(run);
+    }
+    if (climbing && high_bin != NO_PEAK) {
+        _peaks.push_back(high_bin);
+    }
+}
+
+const std::vector<size_t>& mask_compare::peaks(const float* trace, size_t max)
+{
+    max = std::min(max, _peaks.size());
+    std::partial_sort(_peaks.begin(),
+                      _peaks.begin() + max,
+                      _peaks.end(),
+                      [trace](size_t a, size_t b) { return trace[a] > trace[b]; });
+    _peaks.resize(max);
+    return _peaks;
+}
+
+} // namespace signal_hound
+} // namespace gr
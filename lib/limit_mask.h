@@ -0,0 +1,95 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_LIMIT_MASK_H
+#define INCLUDED_SIGNAL_HOUND_LIMIT_MASK_H
+
+#include "sweep_pdu.h"
+#include <cstddef>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+/*
+ * Frequency dependent limit line, either a flat threshold or straight
+ * segments between (frequency, level) points held flat past the ends.
+ * The line is sampled at the bins of a sweep and cached until the sweep
+ * frequencies or the mask change.
+ */
+class limit_mask
+{
+public:
+    explicit limit_mask(double threshold = -80.0);
+
+    void set_threshold(double threshold);
+
+    //! Empty vectors go back to the threshold
+    void set_points(const std::vector<double>& freqs, const std::vector<double>& levels);
+
+    //! The limit at each bin of \p sweep
+    const float* line(const sweep_trace& sweep);
+
+private:
+    double _threshold;
+    std::vector<double> _freqs, _levels;
+    bool _changed;
+    double _start_freq, _bin_size;
+    std::vector<float> _line;
+};
+
+//! A run of bins above the limit
+struct mask_run {
+    size_t first; //!< First bin above the limit
+    size_t last;  //!< Last bin above the limit
+    size_t peak;  //!< Bin furthest above the limit
+    float excess; //!< dB above the limit at \p peak
+};
+
+/*
+ * Compares a trace against a limit line and finds its peaks in one walk.
+ *
+ * A violation opens at the first bin above the limit and closes once the
+ * trace drops \p hysteresis dB below it, so a signal straddling the limit
+ * reports once. A peak is a local maximum at or above \p floor standing
+ * \p excursion dB above the valleys on either side; the floor and the ends
+ * of the trace count as valleys.
+ *
+ * The trace is handled in tiles. The differences to the limit and the
+ * tile maxima come from VOLK, and tiles that are wholly below both the
+ * limit and the floor, the usual case for a monitored band, skip the
+ * per-bin scan.
+ */
+class mask_compare
+{
+public:
+    mask_compare(float hysteresis = 0.0f, float floor = -100.0f, float excursion = 6.0f);
+
+    void set_hysteresis(float hysteresis) { _hysteresis = hysteresis; }
+    void set_peaks(float floor, float excursion);
+
+    void process(const float* trace, const float* limit, size_t n);
+
+    const std::vector<mask_run>& violations() const { return _violations; }
+
+    //! Bins of the peaks found, strongest first, at most \p max kept
+    const std::vector<size_t>& peaks(const float* trace, size_t max);
+
+private:
+    float _hysteresis;
+    float _floor;
+    float _excursion;
+
+    std::vector<float> _excess;
+    std::vector<mask_run> _violations;
+    std::vector<size_t> _peaks;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_LIMIT_MASK_H */
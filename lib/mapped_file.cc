@@ -0,0 +1,69 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "mapped_file.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace gr {
+namespace signal_hound {
+
+mapped_file::mapped_file(const std::string& path) : _fd(-1), _data(nullptr), _size(0)
+{
+    _fd = open(path.c_str(), O_RDONLY);
+    if (_fd < 0) {
+        throw std::runtime_error("cannot open " + path + ": " + strerror(errno));
+    }
+
+    struct stat st;
+    if (fstat(_fd, &st) < 0 || st.st_size == 0) {
+        close(_fd);
+        throw std::runtime_error(path + " is empty or unreadable");
+    }
+    _size = st.st_size;
+
+    void* map = mmap(nullptr, _size, PROT_READ | PROT_WRITE, MAP_PRIVATE, _fd, 0);
+    if (map == MAP_FAILED) {
+        close(_fd);
+        throw std::runtime_error("cannot map " + path + ": " + strerror(errno));
+    }
+    _data = static_cast<uint8_t*>(map);
+    madvise(_data, _size, MADV_SEQUENTIAL);
+}
+
+mapped_file::~mapped_file()
+{
+    munmap(_data, _size);
+    close(_fd);
+}
+
+void mapped_file::advise(size_t offset, size_t len, int advice)
+{
+    static const size_t page = sysconf(_SC_PAGESIZE);
+
+    if (offset >= _size) {
+        return;
+    }
+    len = std::min(len, _size - offset);
+
+    // madvise() wants a page aligned start
+    size_t start = offset / page * page;
+    madvise(_data + start, len + (offset - start), advice);
+}
+
+void mapped_file::prefetch(size_t offset, size_t len) { advise(offset, len, MADV_WILLNEED); }
+
+void mapped_file::release(size_t offset, size_t len) { advise(offset, len, MADV_DONTNEED); }
+
+} // namespace signal_hound
+} // namespace gr
@@ -0,0 +1,53 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_MAPPED_FILE_H
+#define INCLUDED_SIGNAL_HOUND_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace gr {
+namespace signal_hound {
+
+/*
+ * Private, writable memory mapping of a sample file.
+ *
+ * Pages are shared with the page cache until written, so handing the
+ * mapping to an API that takes a non-const pointer costs nothing. Readers
+ * walk the file front to back and use prefetch() ahead of and release()
+ * behind their position, keeping the resident set bounded for files larger
+ * than memory.
+ */
+class mapped_file
+{
+public:
+    explicit mapped_file(const std::string& path);
+    ~mapped_file();
+
+    uint8_t* data() { return _data; }
+    size_t size() const { return _size; }
+
+    //! Ask the kernel to start reading a range in
+    void prefetch(size_t offset, size_t len);
+
+    //! Drop a range that will not be needed again soon
+    void release(size_t offset, size_t len);
+
+private:
+    void advise(size_t offset, size_t len, int advice);
+
+    int _fd;
+    uint8_t* _data;
+    size_t _size;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_MAPPED_FILE_H */
@@ -0,0 +1,131 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "pdu_pool.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+namespace gr {
+namespace signal_hound {
+
+pdu_pool::pdu_pool(int samples_per_pdu, int pool_size, const publish_fn& publish)
+    : _size(samples_per_pdu),
+      _publish(publish),
+      _next(0),
+      _current(nullptr),
+      _fill(0),
+      _ns(0),
+      _loss(false),
+      _have_info(false),
+      _freq(pmt::PMT_NIL),
+      _rate(pmt::PMT_NIL),
+      _dropped(0)
+{
+    if (samples_per_pdu < 1 || pool_size < 1) {
+        throw std::invalid_argument("pdu_pool: PDU and pool sizes must be positive");
+    }
+
+    _pool.resize(pool_size);
+    const int64_t zero = 0;
+    for (slot& s : _pool) {
+        s.samples = pmt::make_c32vector(_size, gr_complex(0.0f, 0.0f));
+        size_t len = 0;
+        s.data = pmt::c32vector_writable_elements(s.samples, len);
+        s.time = pmt::init_s64vector(1, &zero);
+
+        // Kept as entries so emit() can swap their values in place
+        s.freq_entry = pmt::cons(pmt::mp("rx_freq"), pmt::PMT_NIL);
+        s.rate_entry = pmt::cons(pmt::mp("rx_rate"), pmt::PMT_NIL);
+        s.loss_entry = pmt::cons(pmt::mp("sample_loss"), pmt::PMT_F);
+        s.meta = pmt::cons(pmt::cons(pmt::mp("rx_time_ns"), s.time),
+                           pmt::cons(s.freq_entry,
+                                     pmt::cons(s.rate_entry,
+                                               pmt::cons(s.loss_entry, pmt::PMT_NIL))));
+        s.pdu = pmt::cons(s.meta, s.samples);
+    }
+}
+
+pdu_pool::slot* pdu_pool::acquire()
+{
+    // Free when only the pool and the PDU itself hold the parts
+    for (size_t i = 0; i < _pool.size(); i++) {
+        slot& s = _pool[(_next + i) % _pool.size()];
+        if (s.pdu.use_count() == 1 && s.meta.use_count() == 2 &&
+            s.samples.use_count() == 2 && s.time.use_count() == 2) {
+            _next = (_next + i + 1) % _pool.size();
+            return &s;
+        }
+    }
+    return nullptr;
+}
+
+void pdu_pool::emit()
+{
+    slot& s = *_current;
+    size_t len = 0;
+    pmt::s64vector_writable_elements(s.time, len)[0] = _ns;
+    pmt::set_cdr(s.freq_entry, _freq);
+    pmt::set_cdr(s.rate_entry, _rate);
+    pmt::set_cdr(s.loss_entry, _loss ? pmt::PMT_T : pmt::PMT_F);
+    _publish(s.pdu);
+}
+
+void pdu_pool::write(const gr_complex* iq, int len, const stream_info& info)
+{
+    if (!_have_info || info.center != _last_info.center ||
+        info.sample_rate != _last_info.sample_rate) {
+        // Start over on the new tuning
+        _freq = pmt::from_double(info.center);
+        _rate = pmt::from_double(info.sample_rate);
+        _last_info = info;
+        _have_info = true;
+        _current = nullptr;
+        _fill = 0;
+    }
+
+    int pos = 0;
+    while (pos < len) {
+        if (_fill == 0) {
+            _current = acquire();
+            _ns = info.ns_since_epoch
+                      ? info.ns_since_epoch + (int64_t)(pos * 1.0e9 / info.sample_rate)
+                      : 0;
+            _loss = false;
+        }
+        if (pos == 0 && info.sample_loss) {
+            _loss = true;
+        }
+
+        int n = std::min(len - pos, _size - _fill);
+        if (_current) {
+            memcpy(_current->data + _fill, iq + pos, n * sizeof(gr_complex));
+        }
+        _fill += n;
+        pos += n;
+
+        if (_fill == _size) {
+            if (_current) {
+                if (_dropped) {
+                    std::cout << "** PDU pool recovered after dropping " << _dropped
+                              << " PDUs **" << std::endl;
+                    _dropped = 0;
+                }
+                emit();
+            } else if (_dropped++ == 0) {
+                std::cout << "** PDU consumers hold the whole pool, dropping PDUs **"
+                          << std::endl;
+            }
+            _current = nullptr;
+            _fill = 0;
+        }
+    }
+}
+
+} // namespace signal_hound
+} // namespace gr
@@ -0,0 +1,84 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_PDU_POOL_H
+#define INCLUDED_SIGNAL_HOUND_PDU_POOL_H
+
+#include "stream_info.h"
+#include <gnuradio/gr_complex.h>
+#include <pmt/pmt.h>
+#include <functional>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+/*
+ * Cuts the I/Q stream of a source into fixed-size PDUs taken from a pool
+ * allocated up front, for message-based pipelines.
+ *
+ * Each PDU is a (metadata . c32vector) pair built once with its metadata
+ * dictionary. A PDU goes back into use once every consumer has dropped
+ * it, seen from the reference counts, and is then refilled in place, so
+ * a pool large enough for the consumers allocates nothing per PDU. The
+ * metadata carries
+ *
+ *   rx_time_ns   time of the first sample, a one-element s64 vector
+ *   rx_freq      center frequency in Hz
+ *   rx_rate      sample rate
+ *   sample_loss  true if samples were lost before or inside the PDU
+ *
+ * rx_freq and rx_rate are shared between PDUs and replaced on retune. A
+ * PDU never spans a retune; the partial one is dropped. With every PDU
+ * still held by a consumer, new ones are dropped until one comes back.
+ */
+class pdu_pool
+{
+public:
+    typedef std::function<void(const pmt::pmt_t& pdu)> publish_fn;
+
+    pdu_pool(int samples_per_pdu, int pool_size, const publish_fn& publish);
+
+    void write(const gr_complex* iq, int len, const stream_info& info);
+
+private:
+    struct slot {
+        pmt::pmt_t pdu;
+        pmt::pmt_t meta;
+        pmt::pmt_t samples;
+        pmt::pmt_t time;
+        pmt::pmt_t freq_entry;
+        pmt::pmt_t rate_entry;
+        pmt::pmt_t loss_entry;
+        gr_complex* data;
+    };
+
+    slot* acquire();
+    void emit();
+
+    int _size;
+    publish_fn _publish;
+    std::vector<slot> _pool;
+    size_t _next;
+
+    slot* _current; // null while the PDU being filled is dropped
+    int _fill;
+    int64_t _ns;
+    bool _loss;
+
+    bool _have_info;
+    stream_info _last_info;
+    pmt::pmt_t _freq;
+    pmt::pmt_t _rate;
+
+    uint64_t _dropped;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_PDU_POOL_H */
@@ -0,0 +1,149 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "power_manager.h"
+#include <iostream>
+
+namespace gr {
+namespace signal_hound {
+
+power_manager::power_manager(transition_fn standby, transition_fn wake)
+    : _standby(standby),
+      _wake(wake),
+      _state(state::ACTIVE),
+      _prewake(false),
+      _shutdown(false),
+      _timeout(0.0),
+      _wake_latency(0.0),
+      _idle_since(std::chrono::steady_clock::now())
+{
+}
+
+power_manager::~power_manager()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _shutdown = true;
+    }
+    _cond.notify_all();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void power_manager::set_idle_timeout(double seconds)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _timeout = seconds;
+    // The worker only exists once standby has been asked for
+    if (_timeout > 0.0 && !_thread.joinable()) {
+        _thread = std::thread(&power_manager::run, this);
+    }
+    _cond.notify_all();
+}
+
+double power_manager::idle_timeout() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _timeout;
+}
+
+void power_manager::idle()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_state == state::ACTIVE) {
+        _state = state::IDLE;
+        _idle_since = std::chrono::steady_clock::now();
+        _cond.notify_all();
+    }
+}
+
+bool power_manager::active()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    bool woke = false;
+    if (_state == state::STANDBY) {
+        wake_locked(lock);
+        woke = true;
+    }
+    _state = state::ACTIVE;
+    _prewake = false;
+    return woke;
+}
+
+void power_manager::prewake()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_state == state::STANDBY) {
+        _prewake = true;
+    } else if (_state == state::IDLE) {
+        // A start is expected soon, push the standby deadline back
+        _idle_since = std::chrono::steady_clock::now();
+    }
+    _cond.notify_all();
+}
+
+bool power_manager::in_standby() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _state == state::STANDBY;
+}
+
+double power_manager::wake_latency() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _wake_latency;
+}
+
+void power_manager::wake_locked(std::unique_lock<std::mutex>& lock)
+{
+    _state = state::WAKING;
+    auto begin = std::chrono::steady_clock::now();
+    _wake();
+    double elapsed =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+    // Smooth over the last few wakes, the first one seeds the estimate
+    _wake_latency =
+        (_wake_latency == 0.0) ? elapsed : 0.75 * _wake_latency + 0.25 * elapsed;
+    std::cout << "Device woke from standby in " << elapsed * 1e3 << " ms" << std::endl;
+}
+
+void power_manager::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_shutdown) {
+        if (_state == state::STANDBY && _prewake) {
+            wake_locked(lock);
+            _prewake = false;
+            // Fall back to standby if the expected start never arrives
+            _state = state::IDLE;
+            _idle_since = std::chrono::steady_clock::now();
+            continue;
+        }
+
+        if (_state == state::IDLE && _timeout > 0.0) {
+            auto deadline =
+                _idle_since + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                  std::chrono::duration<double>(_timeout));
+            if (std::chrono::steady_clock::now() >= deadline) {
+                _standby();
+                _state = state::STANDBY;
+                std::cout << "Device idle for " << _timeout << " s, entering standby"
+                          << std::endl;
+                continue;
+            }
+            _cond.wait_until(lock, deadline);
+            continue;
+        }
+
+        _cond.wait(lock);
+    }
+}
+
+} /* namespace signal_hound */
+} /* namespace gr */
@@ -0,0 +1,82 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_POWER_MANAGER_H
+#define INCLUDED_SIGNAL_HOUND_POWER_MANAGER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Moves a device into standby after the flowgraph has been idle
+ * for a configurable period, and back on when it is started again.
+ *
+ * The owning block supplies the device specific standby/wake calls and
+ * reports start()/stop() through active()/idle(). Transitions run on a
+ * private worker thread, started by the first positive idle timeout, so
+ * stop() never blocks on the device. The time
+ * taken to wake is tracked so callers can issue prewake() far enough
+ * ahead of start() to hide it.
+ */
+class power_manager
+{
+public:
+    typedef std::function<void(void)> transition_fn;
+
+    power_manager(transition_fn standby, transition_fn wake);
+    ~power_manager();
+
+    //! Idle period before standby in seconds, <= 0 disables standby.
+    void set_idle_timeout(double seconds);
+    double idle_timeout() const;
+
+    //! The flowgraph stopped, arm the idle timer.
+    void idle();
+
+    //! The flowgraph is starting, wake synchronously if in standby.
+    //! Returns true if the device had to be woken.
+    bool active();
+
+    //! Begin waking in the background ahead of an expected start().
+    void prewake();
+
+    bool in_standby() const;
+
+    //! Smoothed time taken to leave standby, in seconds.
+    double wake_latency() const;
+
+private:
+    enum class state { ACTIVE, IDLE, STANDBY, WAKING };
+
+    void run();
+    void wake_locked(std::unique_lock<std::mutex>& lock);
+
+    transition_fn _standby;
+    transition_fn _wake;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _cond;
+    std::thread _thread;
+
+    state _state;
+    bool _prewake;
+    bool _shutdown;
+    double _timeout;
+    double _wake_latency;
+    std::chrono::steady_clock::time_point _idle_since;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_POWER_MANAGER_H */
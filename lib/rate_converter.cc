@@ -0,0 +1,85 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "rate_converter.h"
+#include <gnuradio/filter/firdes.h>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+namespace gr {
+namespace signal_hound {
+
+// Polyphase arms, sets the fractional delay resolution
+static const int FILTERS = 32;
+
+int rate_converter::pick_decimation(double base_rate, double rate, int max_decimation)
+{
+    int decimation = 1;
+    while (decimation * 2 <= max_decimation && base_rate / (decimation * 2) >= rate) {
+        decimation *= 2;
+    }
+    return decimation;
+}
+
+rate_converter::rate_converter(double in_rate, double out_rate)
+    : _in_rate(in_rate), _ratio(out_rate / in_rate), _out_pos(0)
+{
+    // Pass to 40% and stop at 50% of the slower of the two rates
+    double edge = std::min(1.0, _ratio);
+    std::vector<float> taps = gr::filter::firdes::low_pass_2(
+        FILTERS, FILTERS, 0.45 * edge, 0.1 * edge, 80.0, gr::fft::window::WIN_BLACKMAN_hARRIS);
+    _resampler.reset(new gr::filter::kernel::pfb_arb_resampler_ccf(_ratio, taps, FILTERS));
+    _history = _resampler->taps_per_filter() - 1;
+    _in.assign(_history, 0.0f);
+
+    std::cout << "Resampling " << in_rate << " to " << out_rate << " S/s with "
+              << taps.size() / FILTERS << " taps per arm" << std::endl;
+}
+
+double rate_converter::buffered() const
+{
+    return (_in.size() - _history) / _in_rate + (_out.size() - _out_pos) / (_ratio * _in_rate);
+}
+
+void rate_converter::resample(gr_complex* out, int noutput, const read_fn& read)
+{
+    int produced = 0;
+
+    // Surplus from the previous call goes first
+    int n = std::min(noutput, (int)(_out.size() - _out_pos));
+    std::copy(_out.begin() + _out_pos, _out.begin() + _out_pos + n, out);
+    _out_pos += n;
+    produced += n;
+
+    while (produced < noutput) {
+        int to_read = std::max(1, (int)std::ceil((noutput - produced) / _ratio));
+
+        // The last output may step past to_read by up to one input stride
+        int want = to_read + (int)std::ceil(1.0 / _ratio) + 1;
+        int have = _in.size() - _history;
+        if (have < want) {
+            _in.resize(_history + want);
+            read(&_in[_history + have], want - have);
+        }
+
+        // The resampler may overshoot by a sample, keep the surplus
+        _out.resize((size_t)((to_read + 1) * _ratio) + 2);
+        int consumed = 0;
+        int made = _resampler->filter(&_out[0], &_in[0], to_read, consumed);
+        _in.erase(_in.begin(), _in.begin() + consumed);
+
+        n = std::min(noutput - produced, made);
+        std::copy(_out.begin(), _out.begin() + n, out + produced);
+        produced += n;
+        _out.resize(made);
+        _out_pos = n;
+    }
+}
+
+} // namespace signal_hound
+} // namespace gr
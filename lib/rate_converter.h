@@ -0,0 +1,61 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_RATE_CONVERTER_H
+#define INCLUDED_SIGNAL_HOUND_RATE_CONVERTER_H
+
+#include <gnuradio/filter/pfb_arb_resampler.h>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+/*
+ * Takes a device stream to an arbitrary output rate inside a source block.
+ *
+ * The device is set to the slowest power-of-two decimation still at or
+ * above the requested rate and the polyphase arbitrary resampler finishes
+ * the job on the acquisition thread, so only output-rate samples cross the
+ * scheduler. The anti-alias filter passes 80% of the output rate.
+ *
+ * The converter pulls device samples through a read callback as it needs
+ * them and holds on to the filter history and any surplus in between.
+ */
+class rate_converter
+{
+public:
+    //! Reads exactly \p n device samples into \p buf
+    typedef std::function<void(gr_complex* buf, int n)> read_fn;
+
+    //! Largest power-of-two decimation of \p base_rate not below \p rate
+    static int pick_decimation(double base_rate, double rate, int max_decimation);
+
+    rate_converter(double in_rate, double out_rate);
+
+    //! Produce \p noutput samples, reading from the device as needed
+    void resample(gr_complex* out, int noutput, const read_fn& read);
+
+    //! Seconds of device input read but not yet output
+    double buffered() const;
+
+private:
+    double _in_rate;
+    double _ratio;
+    std::unique_ptr<gr::filter::kernel::pfb_arb_resampler_ccf> _resampler;
+    int _history;
+
+    std::vector<gr_complex> _in;  // history followed by unread input
+    std::vector<gr_complex> _out; // surplus output from the last call
+    size_t _out_pos;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_RATE_CONVERTER_H */
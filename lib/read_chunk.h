@@ -0,0 +1,73 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_READ_CHUNK_H
+#define INCLUDED_SIGNAL_HOUND_READ_CHUNK_H
+
+#include <gnuradio/block.h>
+#include <algorithm>
+
+namespace gr {
+namespace signal_hound {
+
+//! Largest minimum request a source asks of the scheduler
+const int MAX_READ_CHUNK = 1 << 17;
+
+/*
+ * Shapes the requests the scheduler makes of a device source.
+ *
+ * Left alone, the scheduler offers whatever room the output buffer has,
+ * so the API is called with small, odd-sized requests that split device
+ * transfers and pay the per-call cost over and over. The output multiple
+ * is set to the device transfer size, or its largest divisor the latency
+ * budget allows when a whole transfer does not fit, and the minimum request
+ * to as many of those as fit in the budget. A latency of zero restores the
+ * default behaviour. Sources framing their output count \p item_samples
+ * new samples per item. Call from the work thread, the scheduler reads
+ * these between calls to general_work().
+ */
+inline void apply_read_chunk(gr::block* block,
+                             double sample_rate,
+                             int device_packet,
+                             double latency,
+                             int item_samples = 1)
+{
+    if (latency <= 0.0 || sample_rate <= 0.0) {
+        block->set_output_multiple(1);
+        block->set_min_noutput_items(0);
+        return;
+    }
+
+    int budget =
+        std::max(1, std::min(MAX_READ_CHUNK, (int)(sample_rate * latency)) / item_samples);
+    int packet = std::max(1, device_packet / item_samples);
+    int multiple = packet <= budget ? packet : 1;
+    for (int d = 1; multiple < packet && d * d <= packet; d++) {
+        if (packet % d == 0) {
+            if (d <= budget) {
+                multiple = std::max(multiple, d);
+            }
+            if (packet / d <= budget) {
+                multiple = std::max(multiple, packet / d);
+            }
+        }
+    }
+
+    block->set_output_multiple(multiple);
+    block->set_min_noutput_items(budget / multiple * multiple);
+}
+
+//! Reserve output buffer room for the largest chunk, call from the constructor
+inline void reserve_read_chunk(gr::block* block, int item_samples = 1)
+{
+    block->set_min_output_buffer(std::max(2, 2 * MAX_READ_CHUNK / item_samples));
+}
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_READ_CHUNK_H */
@@ -0,0 +1,310 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "shm_ring.h"
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+
+namespace gr {
+namespace signal_hound {
+
+static size_t header_bytes()
+{
+    size_t page = sysconf(_SC_PAGESIZE);
+    return (sizeof(shm_ring_header) + page - 1) / page * page;
+}
+
+static std::string shm_path(const std::string& name)
+{
+    return name.empty() || name[0] != '/' ? "/" + name : name;
+}
+
+static bool pid_alive(int32_t pid)
+{
+    return pid != 0 && (kill(pid, 0) == 0 || errno == EPERM);
+}
+
+//! A complete ring whose writer has exited, safe to replace
+static bool ring_is_stale(const std::string& name)
+{
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        return false;
+    }
+    bool stale = false;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && (size_t)st.st_size >= header_bytes()) {
+        void* map = mmap(nullptr, header_bytes(), PROT_READ, MAP_SHARED, fd, 0);
+        if (map != MAP_FAILED) {
+            const shm_ring_header* header = static_cast<const shm_ring_header*>(map);
+            stale = header->magic == SHM_RING_MAGIC && !pid_alive(header->writer_pid.load());
+            munmap(map, header_bytes());
+        }
+    }
+    close(fd);
+    return stale;
+}
+
+shm_ring_writer::shm_ring_writer(const std::string& name, size_t capacity)
+    : _name(shm_path(name)), _fd(-1), _map_size(0), _header(nullptr), _have_info(false)
+{
+    size_t pow2 = 1;
+    while (pow2 < capacity) {
+        pow2 <<= 1;
+    }
+    _mask = pow2 - 1;
+
+    // A ring left by a writer that has exited is replaced, its readers keep
+    // their old mapping and notice the writer is gone. A name held by a live
+    // writer, or one still being created, is not taken over. Only processes
+    // of the same user may map the stream.
+    _fd = shm_open(_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (_fd < 0 && errno == EEXIST && ring_is_stale(_name)) {
+        shm_unlink(_name.c_str());
+        _fd = shm_open(_name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    }
+    if (_fd < 0) {
+        throw std::runtime_error("shm_ring: cannot create " + _name + ": " + strerror(errno));
+    }
+
+    _map_size = header_bytes() + pow2 * sizeof(gr_complex);
+    if (ftruncate(_fd, _map_size) < 0) {
+        close(_fd);
+        shm_unlink(_name.c_str());
+        throw std::runtime_error("shm_ring: cannot size " + _name + ": " + strerror(errno));
+    }
+
+    void* map = mmap(nullptr, _map_size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (map == MAP_FAILED) {
+        close(_fd);
+        shm_unlink(_name.c_str());
+        throw std::runtime_error("shm_ring: cannot map " + _name + ": " + strerror(errno));
+    }
+
+    _header = static_cast<shm_ring_header*>(map);
+    _data = reinterpret_cast<gr_complex*>(static_cast<char*>(map) + header_bytes());
+
+    memset(static_cast<void*>(_header), 0, sizeof(shm_ring_header));
+    _header->header_size = header_bytes();
+    _header->capacity = pow2;
+    _header->writer_pid.store(getpid());
+    std::atomic_thread_fence(std::memory_order_release);
+    _header->magic = SHM_RING_MAGIC;
+
+    std::cout << "Publishing I/Q to shared memory " << _name << ", " << pow2 << " samples"
+              << std::endl;
+}
+
+shm_ring_writer::~shm_ring_writer()
+{
+    _header->writer_pid.store(0);
+    munmap(_header, _map_size);
+    close(_fd);
+    shm_unlink(_name.c_str());
+}
+
+void shm_ring_writer::publish_info(const stream_info& info)
+{
+    uint64_t index = _header->info_count.load(std::memory_order_relaxed);
+    shm_ring_info& entry = _header->info[index % SHM_RING_INFO_ENTRIES];
+    entry.position = _header->write_pos.load(std::memory_order_relaxed);
+    entry.center = info.center;
+    entry.sample_rate = info.sample_rate;
+    entry.bandwidth = info.bandwidth;
+    entry.reflevel = info.reflevel;
+    entry.ns_since_epoch = info.ns_since_epoch;
+    entry.sample_loss = info.sample_loss;
+    _header->info_count.store(index + 1, std::memory_order_release);
+}
+
+void shm_ring_writer::write(const gr_complex* iq, int len, const stream_info& info)
+{
+    if (!_have_info || info.sample_loss || info.tuning_differs(_last_info)) {
+        publish_info(info);
+        _last_info = info;
+        _have_info = true;
+    }
+
+    const uint64_t capacity = _mask + 1;
+    while (len > 0) {
+        size_t n = std::min((uint64_t)len, capacity);
+        uint64_t pos = _header->write_pos.load(std::memory_order_relaxed);
+
+        // Announce the region being overwritten before touching it
+        _header->reserve_pos.store(pos + n, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        size_t start = pos & _mask;
+        size_t first = std::min(n, (size_t)(capacity - start));
+        memcpy(_data + start, iq, first * sizeof(gr_complex));
+        memcpy(_data, iq + first, (n - first) * sizeof(gr_complex));
+
+        _header->write_pos.store(pos + n, std::memory_order_release);
+        iq += n;
+        len -= n;
+    }
+}
+
+shm_ring_reader::shm_ring_reader(const std::string& name)
+    : _name(shm_path(name)), _fd(-1), _map_size(0), _header(nullptr), _slot(nullptr)
+{
+    _fd = shm_open(_name.c_str(), O_RDWR, 0);
+    if (_fd < 0) {
+        throw std::runtime_error("shm_ring: cannot open " + _name + ": " + strerror(errno));
+    }
+
+    // The writer sizes the object after creating it, and touching a page
+    // past the end of it raises SIGBUS, so wait for the header to exist
+    struct stat st;
+    for (int i = 0; i < 100; i++) {
+        if (fstat(_fd, &st) < 0 || (size_t)st.st_size >= header_bytes()) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    if (fstat(_fd, &st) < 0 || (size_t)st.st_size < header_bytes()) {
+        close(_fd);
+        throw std::runtime_error("shm_ring: " + _name + " is not an I/Q ring");
+    }
+
+    // Map the header alone first to learn the ring size
+    void* map = mmap(nullptr, header_bytes(), PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (map == MAP_FAILED) {
+        close(_fd);
+        throw std::runtime_error("shm_ring: cannot map " + _name + ": " + strerror(errno));
+    }
+    shm_ring_header* header = static_cast<shm_ring_header*>(map);
+    for (int i = 0; i < 100 && header->magic != SHM_RING_MAGIC; i++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    if (header->magic != SHM_RING_MAGIC) {
+        munmap(map, header_bytes());
+        close(_fd);
+        throw std::runtime_error("shm_ring: " + _name + " is not an I/Q ring");
+    }
+    uint64_t capacity = header->capacity;
+    size_t offset = header->header_size;
+    munmap(map, header_bytes());
+
+    _map_size = offset + capacity * sizeof(gr_complex);
+    if (fstat(_fd, &st) < 0 || (size_t)st.st_size < _map_size) {
+        close(_fd);
+        throw std::runtime_error("shm_ring: " + _name + " is shorter than its ring");
+    }
+    map = mmap(nullptr, _map_size, PROT_READ | PROT_WRITE, MAP_SHARED, _fd, 0);
+    if (map == MAP_FAILED) {
+        close(_fd);
+        throw std::runtime_error("shm_ring: cannot map " + _name + ": " + strerror(errno));
+    }
+    _header = static_cast<shm_ring_header*>(map);
+    _data = reinterpret_cast<const gr_complex*>(static_cast<char*>(map) + offset);
+    _mask = capacity - 1;
+
+    // Join live, starting with the most recent stream description
+    _cursor = _header->write_pos.load(std::memory_order_acquire);
+    uint64_t infos = _header->info_count.load(std::memory_order_acquire);
+    _info_read = infos ? infos - 1 : 0;
+
+    for (size_t i = 0; i < SHM_RING_MAX_READERS; i++) {
+        // Free slots and those left by readers that died without releasing them
+        int32_t free_pid = _header->readers[i].pid.load();
+        if (free_pid != 0 && !(kill(free_pid, 0) < 0 && errno == ESRCH)) {
+            continue;
+        }
+        if (_header->readers[i].pid.compare_exchange_strong(free_pid, getpid())) {
+            _slot = &_header->readers[i];
+            _slot->cursor.store(_cursor);
+            _slot->overruns.store(0);
+            break;
+        }
+    }
+}
+
+shm_ring_reader::~shm_ring_reader()
+{
+    if (_slot) {
+        _slot->pid.store(0);
+    }
+    munmap(_header, _map_size);
+    close(_fd);
+}
+
+bool shm_ring_reader::writer_alive() const
+{
+    return pid_alive(_header->writer_pid.load());
+}
+
+int shm_ring_reader::read(gr_complex* out, int len, bool& overrun)
+{
+    const uint64_t capacity = _mask + 1;
+    overrun = false;
+
+    uint64_t written = _header->write_pos.load(std::memory_order_acquire);
+    if (written - _cursor > capacity) {
+        // Lapped, resume half a ring behind the writer
+        _cursor = written - capacity / 2;
+        overrun = true;
+    }
+
+    size_t n = std::min((uint64_t)len, written - _cursor);
+    size_t start = _cursor & _mask;
+    size_t first = std::min(n, (size_t)(capacity - start));
+    memcpy(out, _data + start, first * sizeof(gr_complex));
+    memcpy(out + first, _data, (n - first) * sizeof(gr_complex));
+
+    // Discard the copy if the writer started overwriting it meanwhile
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t reserved = _header->reserve_pos.load(std::memory_order_relaxed);
+    if (reserved - _cursor > capacity) {
+        _cursor = reserved - capacity / 2;
+        overrun = true;
+        n = 0;
+    } else {
+        _cursor += n;
+    }
+
+    if (_slot) {
+        _slot->cursor.store(_cursor, std::memory_order_relaxed);
+        if (overrun) {
+            _slot->overruns.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    return n;
+}
+
+bool shm_ring_reader::next_info(uint64_t position, shm_ring_info& info)
+{
+    uint64_t count = _header->info_count.load(std::memory_order_acquire);
+    if (count - _info_read > SHM_RING_INFO_ENTRIES) {
+        _info_read = count - SHM_RING_INFO_ENTRIES;
+    }
+    if (_info_read == count) {
+        return false;
+    }
+
+    const shm_ring_info& entry = _header->info[_info_read % SHM_RING_INFO_ENTRIES];
+    if (entry.position >= position) {
+        return false;
+    }
+    info = entry;
+    _info_read++;
+    return true;
+}
+
+} // namespace signal_hound
+} // namespace gr
@@ -0,0 +1,126 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SHM_RING_H
+#define INCLUDED_SIGNAL_HOUND_SHM_RING_H
+
+#include "stream_info.h"
+#include <gnuradio/gr_complex.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace gr {
+namespace signal_hound {
+
+/*
+ * Single producer, many consumer I/Q ring in POSIX shared memory.
+ *
+ * The device owner writes samples and advances write_pos; it never looks
+ * at the readers, so its cost does not depend on how many there are. Each
+ * reader keeps its own cursor and detects being lapped by comparing it
+ * with write_pos before copying and reserve_pos after. Stream changes (retunes, sample
+ * loss) are published in a small log of positioned info entries.
+ */
+
+const uint32_t SHM_RING_MAGIC = 0x53485231; // "SHR1"
+const size_t SHM_RING_MAX_READERS = 32;
+const size_t SHM_RING_INFO_ENTRIES = 64;
+
+struct shm_ring_info {
+    uint64_t position; //!< First sample the entry applies to
+    double center;
+    double sample_rate;
+    double bandwidth;
+    double reflevel;
+    int64_t ns_since_epoch; //!< Time of the sample at position
+    uint32_t sample_loss;
+    uint32_t reserved;
+};
+
+struct shm_ring_reader_slot {
+    std::atomic<uint64_t> cursor;
+    std::atomic<uint64_t> overruns;
+    std::atomic<int32_t> pid; //!< 0 while the slot is free, reclaimed if the reader died
+    uint32_t reserved;
+};
+
+struct shm_ring_header {
+    uint32_t magic;
+    uint32_t header_size;
+    uint64_t capacity; //!< Samples, a power of two
+    std::atomic<uint64_t> reserve_pos; //!< Samples about to be overwritten up to here
+    std::atomic<uint64_t> write_pos;   //!< Samples valid up to here
+    std::atomic<uint64_t> info_count;
+    std::atomic<int32_t> writer_pid;
+    uint32_t reserved;
+    shm_ring_info info[SHM_RING_INFO_ENTRIES];
+    shm_ring_reader_slot readers[SHM_RING_MAX_READERS];
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free,
+              "shared memory ring needs lock free 64-bit atomics");
+
+//! Owner side, created by a device source block
+class shm_ring_writer
+{
+public:
+    shm_ring_writer(const std::string& name, size_t capacity);
+    ~shm_ring_writer();
+
+    void write(const gr_complex* iq, int len, const stream_info& info);
+
+private:
+    void publish_info(const stream_info& info);
+
+    std::string _name;
+    int _fd;
+    size_t _map_size;
+    shm_ring_header* _header;
+    gr_complex* _data;
+    uint64_t _mask;
+    bool _have_info;
+    stream_info _last_info;
+};
+
+//! Consumer side, used by shm_source
+class shm_ring_reader
+{
+public:
+    explicit shm_ring_reader(const std::string& name);
+    ~shm_ring_reader();
+
+    /*!
+     * Copy up to \p len samples. Returns the number copied. Sets \p overrun
+     * when the writer lapped this reader and samples were skipped.
+     */
+    int read(gr_complex* out, int len, bool& overrun);
+
+    //! Next info entry taking effect before \p position, false if none.
+    bool next_info(uint64_t position, shm_ring_info& info);
+
+    uint64_t cursor() const { return _cursor; }
+    const std::string& name() const { return _name; }
+    bool writer_alive() const;
+
+private:
+    std::string _name;
+    int _fd;
+    size_t _map_size;
+    shm_ring_header* _header;
+    const gr_complex* _data;
+    uint64_t _mask;
+    uint64_t _cursor;
+    uint64_t _info_read;
+    shm_ring_reader_slot* _slot;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SHM_RING_H */
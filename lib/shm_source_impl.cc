@@ -0,0 +1,122 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "shm_source_impl.h"
+#include "trace_span.h"
+#include <gnuradio/io_signature.h>
+#include <chrono>
+#include <iostream>
+#include <thread>
+
+namespace gr {
+namespace signal_hound {
+
+// How long work() waits for the writer before returning nothing
+static const int IDLE_POLLS = 100;
+static const auto POLL_PERIOD = std::chrono::milliseconds(1);
+
+using output_type = gr_complex;
+shm_source::sptr shm_source::make(const std::string& name)
+{
+    return gnuradio::make_block_sptr<shm_source_impl>(name);
+}
+
+
+/*
+ * The private constructor
+ */
+shm_source_impl::shm_source_impl(const std::string& name)
+    : gr::sync_block("shm_source",
+                     gr::io_signature::make(0, 0, 0),
+                     gr::io_signature::make(1 /* min outputs */, 1 /*max outputs */, sizeof(output_type))),
+      _ring(new shm_ring_reader(name)),
+      _overruns(0),
+      _have_info(false),
+      _tag_time(true)
+{
+}
+
+/*
+ * Our virtual destructor.
+ */
+shm_source_impl::~shm_source_impl() {}
+
+uint64_t shm_source_impl::overruns() { return _overruns; }
+
+void shm_source_impl::tag_time(uint64_t offset, uint64_t position)
+{
+    if (!_have_info) {
+        return;
+    }
+
+    // Extrapolate from the last info entry to the tagged sample
+    int64_t ns = _info.ns_since_epoch +
+                 (int64_t)((position - _info.position) * 1.0e9 / _info.sample_rate);
+    add_item_tag(0,
+                 offset,
+                 pmt::mp("rx_time"),
+                 pmt::make_tuple(pmt::from_uint64(ns / 1000000000),
+                                 pmt::from_double((ns % 1000000000) * 1.0e-9)));
+    _tag_time = false;
+}
+
+int shm_source_impl::work(int noutput_items,
+                          gr_vector_const_void_star& input_items,
+                          gr_vector_void_star& output_items)
+{
+    SH_TRACE("work", "shm_source::work");
+    auto out = static_cast<output_type*>(output_items[0]);
+
+    int n = 0;
+    for (int polls = 0; n == 0 && polls < IDLE_POLLS; polls++) {
+        bool overrun;
+        n = _ring->read(out, noutput_items, overrun);
+        if (overrun) {
+            _overruns++;
+            _tag_time = true;
+        }
+        if (n == 0) {
+            SH_TRACE("ring", "ring_wait");
+            std::this_thread::sleep_for(POLL_PERIOD);
+        }
+    }
+    if (n == 0) {
+        if (!_ring->writer_alive()) {
+            std::cout << "** shm_source: the writer of " << _ring->name() << " is gone **"
+                      << std::endl;
+            return WORK_DONE;
+        }
+        return 0;
+    }
+
+    uint64_t end = _ring->cursor();
+    uint64_t start = end - n;
+    uint64_t offset = nitems_written(0);
+
+    shm_ring_info info;
+    while (_ring->next_info(end, info)) {
+        uint64_t at = info.position > start ? info.position : start;
+        if (!_have_info || info.center != _info.center ||
+            info.sample_rate != _info.sample_rate) {
+            add_item_tag(0, offset + at - start, pmt::mp("rx_freq"), pmt::from_double(info.center));
+            add_item_tag(0, offset + at - start, pmt::mp("rx_rate"), pmt::from_double(info.sample_rate));
+        }
+        _info = info;
+        _have_info = true;
+        if (_tag_time || info.sample_loss) {
+            tag_time(offset + at - start, at);
+        }
+    }
+    if (_tag_time) {
+        tag_time(offset, start);
+    }
+
+    return n;
+}
+
+} /* namespace signal_hound */
+} /* namespace gr */
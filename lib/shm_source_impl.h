@@ -0,0 +1,45 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SHM_SOURCE_IMPL_H
+#define INCLUDED_SIGNAL_HOUND_SHM_SOURCE_IMPL_H
+
+#include "shm_ring.h"
+#include <gnuradio/signal_hound/shm_source.h>
+#include <atomic>
+#include <memory>
+
+namespace gr {
+namespace signal_hound {
+
+class shm_source_impl : public shm_source
+{
+private:
+    std::unique_ptr<shm_ring_reader> _ring;
+    std::atomic<uint64_t> _overruns;
+
+    bool _have_info;
+    shm_ring_info _info;
+    bool _tag_time;
+
+    void tag_time(uint64_t offset, uint64_t position);
+
+public:
+    shm_source_impl(const std::string& name);
+    ~shm_source_impl();
+
+    uint64_t overruns();
+
+    int work(int noutput_items,
+             gr_vector_const_void_star& input_items,
+             gr_vector_void_star& output_items);
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SHM_SOURCE_IMPL_H */
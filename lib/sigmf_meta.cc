@@ -0,0 +1,108 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "sigmf_meta.h"
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace gr {
+namespace signal_hound {
+
+static bool ends_with(const std::string& s, const std::string& suffix)
+{
+    return s.size() >= suffix.size() &&
+           s.compare(s.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+//! Position just past the ':' following "key", or npos
+static size_t find_value(const std::string& json, const std::string& key, size_t from = 0)
+{
+    size_t pos = json.find("\"" + key + "\"", from);
+    if (pos == std::string::npos) {
+        return pos;
+    }
+    pos = json.find(':', pos + key.size() + 2);
+    return pos == std::string::npos ? pos : pos + 1;
+}
+
+static std::string string_value(const std::string& json, const std::string& key)
+{
+    size_t pos = find_value(json, key);
+    if (pos == std::string::npos || (pos = json.find('"', pos)) == std::string::npos) {
+        return "";
+    }
+    size_t end = json.find('"', pos + 1);
+    return end == std::string::npos ? "" : json.substr(pos + 1, end - pos - 1);
+}
+
+static double number_value(const std::string& json, const std::string& key, size_t from = 0)
+{
+    size_t pos = find_value(json, key, from);
+    return pos == std::string::npos ? 0.0 : strtod(json.c_str() + pos, nullptr);
+}
+
+bool sigmf_meta::load(const std::string& path)
+{
+    if (!ends_with(path, ".sigmf-meta") && !ends_with(path, ".sigmf-data")) {
+        return false;
+    }
+    std::string base = path.substr(0, path.size() - 11);
+
+    std::ifstream in(base + ".sigmf-meta");
+    if (!in) {
+        throw std::runtime_error("SigMF metadata " + base + ".sigmf-meta not found");
+    }
+    std::stringstream ss;
+    ss << in.rdbuf();
+    std::string json = ss.str();
+
+    std::string datatype = string_value(json, "core:datatype");
+    if (datatype == "cf32_le") {
+        format = SAMPLE_FC32;
+    } else if (datatype == "ci16_le") {
+        format = SAMPLE_SC16;
+    } else {
+        throw std::runtime_error("SigMF datatype '" + datatype + "' is not supported");
+    }
+
+    data_path = base + ".sigmf-data";
+    sample_rate = number_value(json, "core:sample_rate");
+    size_t captures = json.find("\"captures\"");
+    frequency =
+        captures == std::string::npos ? 0.0 : number_value(json, "core:frequency", captures);
+    return true;
+}
+
+sigmf_meta resolve_sample_file(const std::string& path, const std::string& format)
+{
+    sigmf_meta meta;
+    if ((format == "auto" || format == "sigmf") && meta.load(path)) {
+        return meta;
+    }
+    if (format == "sigmf") {
+        throw std::invalid_argument(path + " is not a SigMF recording");
+    }
+
+    meta.data_path = path;
+    meta.sample_rate = 0.0;
+    meta.frequency = 0.0;
+    if (format == "sc16" ||
+        (format == "auto" && (ends_with(path, ".sc16") || ends_with(path, ".cs16") ||
+                              ends_with(path, ".ci16")))) {
+        meta.format = SAMPLE_SC16;
+    } else if (format == "fc32" || format == "auto") {
+        meta.format = SAMPLE_FC32;
+    } else {
+        throw std::invalid_argument("unknown sample format '" + format + "'");
+    }
+    return meta;
+}
+
+} // namespace signal_hound
+} // namespace gr
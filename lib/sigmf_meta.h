@@ -0,0 +1,47 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SIGMF_META_H
+#define INCLUDED_SIGNAL_HOUND_SIGMF_META_H
+
+#include <string>
+
+namespace gr {
+namespace signal_hound {
+
+//! Sample encodings the replay paths understand
+enum sample_format { SAMPLE_FC32, SAMPLE_SC16 };
+
+/*
+ * The few SigMF fields needed to replay a recording: the data type, the
+ * global sample rate and the frequency of the first capture segment. Only
+ * little-endian complex float32 and int16 data is accepted.
+ */
+struct sigmf_meta {
+    std::string data_path;
+    sample_format format;
+    double sample_rate; //!< 0 if not given
+    double frequency;   //!< 0 if not given
+
+    /*!
+     * Fill in from a .sigmf-meta or .sigmf-data path. Returns false if
+     * \p path is not part of a SigMF recording; throws if it is but cannot
+     * be replayed.
+     */
+    bool load(const std::string& path);
+};
+
+/*!
+ * Resolve a file and format name ("auto", "fc32", "sc16" or "sigmf") to the
+ * data file, its encoding and any rate and frequency recorded alongside.
+ */
+sigmf_meta resolve_sample_file(const std::string& path, const std::string& format);
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SIGMF_META_H */
@@ -0,0 +1,494 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "sm_cue_capture_impl.h"
+#include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+
+namespace gr {
+namespace signal_hound {
+
+// Defined in sm_series_impl.cc
+void ERROR_CHECK(const char* call, SmStatus status);
+SmDeviceType SMStringToType(std::string typeString);
+
+// I/Q rate before decimation
+static const double BASE_RATE = 50.0e6;
+// Fraction of the I/Q sample rate kept by the software filter
+static const double IQ_BANDWIDTH = 0.8;
+static const int MAX_DECIMATION = 4096;
+// Immediate triggers fire at once, this only bounds a stuck capture
+static const double SEGMENT_TIMEOUT = 1.0;
+
+static bool parse_mode(const std::string& mode)
+{
+    if (mode != "segmented" && mode != "streaming") {
+        throw std::invalid_argument("sm_cue_capture: mode must be segmented or streaming");
+    }
+    return mode == "streaming";
+}
+
+static void check_capture(int capture_len, int decimation)
+{
+    if (capture_len <= 0) {
+        throw std::invalid_argument("sm_cue_capture: capture length must be positive");
+    }
+    if (decimation < 1 || decimation > MAX_DECIMATION || (decimation & (decimation - 1))) {
+        throw std::invalid_argument("sm_cue_capture: decimation must be a power of two");
+    }
+}
+
+sm_cue_capture::sptr sm_cue_capture::make(double start,
+                                          double stop,
+                                          double rbw,
+                                          double reflevel,
+                                          double threshold,
+                                          int capture_len,
+                                          int decimation,
+                                          const std::string& mode,
+                                          int max_captures,
+                                          double holdoff,
+                                          double dwell,
+                                          const std::string& type,
+                                          const std::string& hostAddr,
+                                          const std::string& deviceAddr,
+                                          uint16_t port)
+{
+    return gnuradio::make_block_sptr<sm_cue_capture_impl>(start,
+                                                          stop,
+                                                          rbw,
+                                                          reflevel,
+                                                          threshold,
+                                                          capture_len,
+                                                          decimation,
+                                                          mode,
+                                                          max_captures,
+                                                          holdoff,
+                                                          dwell,
+                                                          type,
+                                                          hostAddr,
+                                                          deviceAddr,
+                                                          port);
+}
+
+
+/*
+ * The private constructor
+ */
+sm_cue_capture_impl::sm_cue_capture_impl(double start,
+                                         double stop,
+                                         double rbw,
+                                         double reflevel,
+                                         double threshold,
+                                         int capture_len,
+                                         int decimation,
+                                         const std::string& mode,
+                                         int max_captures,
+                                         double holdoff,
+                                         double dwell,
+                                         const std::string& type,
+                                         const std::string& hostAddr,
+                                         const std::string& deviceAddr,
+                                         uint16_t port)
+    : gr::block("sm_cue_capture", gr::io_signature::make(0, 0, 0), gr::io_signature::make(0, 0, 0)),
+      _handle(-1),
+      _start(start),
+      _stop(stop),
+      _rbw(rbw),
+      _reflevel(reflevel),
+      _mask(threshold),
+      _capture_len(capture_len),
+      _decimation(decimation),
+      _streaming(parse_mode(mode)),
+      _max_captures(max_captures),
+      _holdoff(holdoff),
+      _dwell(dwell),
+      _sweep_changed(true),
+      _rate(0.0),
+      _bandwidth(0.0),
+      _running(false),
+      _sweeps(0),
+      _captures(0),
+      _last_reaction(0.0),
+      _max_reaction(0.0),
+      _total_reaction(0.0),
+      _reactions(0)
+{
+    if (stop <= start) {
+        throw std::invalid_argument("sm_cue_capture: stop must be above start");
+    }
+    check_capture(capture_len, decimation);
+
+    std::cout << "\nAPI Version: " << smGetAPIVersion() << std::endl;
+
+    // Open device in the background, start() waits for it
+    SmDeviceType open_type = SMStringToType(type);
+    _open.reset(new device_open("SM", [this, open_type, hostAddr, deviceAddr, port]() {
+        SmDeviceType dtype = open_type;
+        if (dtype == smDeviceTypeSM200A || dtype == smDeviceTypeSM200B ||
+            dtype == smDeviceTypeSM435B) {
+            ERROR_CHECK("smOpenDevice", smOpenDevice(&_handle));
+        } else {
+            ERROR_CHECK(
+                "smOpenNetworkedDevice",
+                smOpenNetworkedDevice(&_handle, hostAddr.c_str(), deviceAddr.c_str(), port));
+        }
+
+        int serial;
+        ERROR_CHECK("smGetDeviceInfo", smGetDeviceInfo(_handle, &dtype, &serial));
+        std::cout << "Serial Number: " << serial << std::endl;
+    }));
+
+    message_port_register_out(pmt::mp("sweeps"));
+    message_port_register_out(pmt::mp("captures"));
+}
+
+/*
+ * Our virtual destructor.
+ */
+sm_cue_capture_impl::~sm_cue_capture_impl()
+{
+    _running = false;
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+    _open.reset();
+    if (_handle >= 0) {
+        smAbort(_handle);
+        smCloseDevice(_handle);
+    }
+}
+
+void sm_cue_capture_impl::set_span(double start, double stop)
+{
+    if (stop <= start) {
+        throw std::invalid_argument("sm_cue_capture: stop must be above start");
+    }
+    gr::thread::scoped_lock lock(_mutex);
+    _start = start;
+    _stop = stop;
+    _sweep_changed = true;
+}
+
+void sm_cue_capture_impl::set_rbw(double rbw)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _rbw = rbw;
+    _sweep_changed = true;
+}
+
+void sm_cue_capture_impl::set_reflevel(double reflevel)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _reflevel = reflevel;
+}
+
+void sm_cue_capture_impl::set_threshold(double threshold)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _mask.set_threshold(threshold);
+}
+
+void sm_cue_capture_impl::set_mask(const std::vector<double>& freqs,
+                                   const std::vector<double>& levels)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _mask.set_points(freqs, levels);
+}
+
+void sm_cue_capture_impl::set_capture(int capture_len, int decimation)
+{
+    check_capture(capture_len, decimation);
+    gr::thread::scoped_lock lock(_mutex);
+    _capture_len = capture_len;
+    _decimation = decimation;
+}
+
+void sm_cue_capture_impl::set_mode(const std::string& mode)
+{
+    bool streaming = parse_mode(mode);
+    gr::thread::scoped_lock lock(_mutex);
+    _streaming = streaming;
+}
+
+void sm_cue_capture_impl::set_max_captures(int max_captures)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _max_captures = max_captures;
+}
+
+void sm_cue_capture_impl::set_holdoff(double holdoff)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _holdoff = holdoff;
+}
+
+void sm_cue_capture_impl::set_dwell(double dwell)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _dwell = dwell;
+}
+
+uint64_t sm_cue_capture_impl::sweeps() { return _sweeps; }
+
+uint64_t sm_cue_capture_impl::captures() { return _captures; }
+
+double sm_cue_capture_impl::last_reaction_time() { return _last_reaction; }
+
+double sm_cue_capture_impl::mean_reaction_time()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _reactions ? _total_reaction / _reactions : 0.0;
+}
+
+double sm_cue_capture_impl::max_reaction_time() { return _max_reaction; }
+
+void sm_cue_capture_impl::configure_sweep()
+{
+    gr::thread::scoped_lock lock(_mutex);
+
+    // Sweep settings are kept across I/Q captures, only the mode changes
+    if (_sweep_changed) {
+        ERROR_CHECK("smSetSweepStartStop", smSetSweepStartStop(_handle, _start, _stop));
+        ERROR_CHECK("smSetSweepCoupling", smSetSweepCoupling(_handle, _rbw, _rbw, 0.001));
+        ERROR_CHECK("smSetSweepDetector",
+                    smSetSweepDetector(_handle, smDetectorMinMax, smVideoPower));
+        ERROR_CHECK("smSetSweepScale", smSetSweepScale(_handle, smScaleLog));
+        ERROR_CHECK("smSetAttenuator", smSetAttenuator(_handle, -1));
+    }
+    ERROR_CHECK("smSetRefLevel", smSetRefLevel(_handle, _reflevel));
+    ERROR_CHECK("smConfigure", smConfigure(_handle, smModeSweeping));
+
+    if (_sweep_changed) {
+        double vbw;
+        int bins;
+        ERROR_CHECK("smGetSweepParameters",
+                    smGetSweepParameters(
+                        _handle, &_sweep.rbw, &vbw, &_sweep.start_freq, &_sweep.bin_size, &bins));
+        _sweep.bins.resize(bins);
+        _sweep_changed = false;
+    }
+}
+
+void sm_cue_capture_impl::detect()
+{
+    int64_t now = _sweep.ns_since_epoch;
+    int64_t holdoff;
+    double covered;
+    size_t max_captures;
+    const float* limit;
+    {
+        gr::thread::scoped_lock lock(_mutex);
+        limit = _mask.line(_sweep);
+        holdoff = (int64_t)(_holdoff * 1.0e9);
+        covered = 0.5 * IQ_BANDWIDTH * BASE_RATE / _decimation;
+        // Streaming follows the strongest detection only
+        max_captures = _streaming ? 1 : std::max(0, _max_captures);
+    }
+
+    // Each run of bins over the limit is one detection
+    _compare.process(_sweep.bins.data(), limit, _sweep.bins.size());
+    _detections.clear();
+    for (const mask_run& run : _compare.violations()) {
+        _detections.push_back({ _sweep.freq(run.peak), _sweep.bins[run.peak], run.excess });
+    }
+    std::sort(_detections.begin(), _detections.end(), [](const detection& a, const detection& b) {
+        return a.excess > b.excess;
+    });
+
+    // Skip peaks a recent capture already covered, strongest first
+    _recent.erase(std::remove_if(_recent.begin(),
+                                 _recent.end(),
+                                 [&](const std::pair<double, int64_t>& r) {
+                                     return now - r.second >= holdoff;
+                                 }),
+                  _recent.end());
+    size_t kept = 0;
+    for (const detection& d : _detections) {
+        if (kept == max_captures) {
+            break;
+        }
+        bool seen = std::any_of(_recent.begin(),
+                                _recent.end(),
+                                [&](const std::pair<double, int64_t>& r) {
+                                    return std::abs(r.first - d.freq) < covered;
+                                });
+        if (!seen) {
+            _recent.push_back({ d.freq, now });
+            _detections[kept++] = d;
+        }
+    }
+    _detections.resize(kept);
+}
+
+void sm_cue_capture_impl::publish(const detection& d,
+                                  int64_t detect_ns,
+                                  int64_t ns,
+                                  int segment,
+                                  bool loss)
+{
+    double reaction = (ns - detect_ns) * 1.0e-9;
+    if (segment == 0) {
+        _last_reaction = reaction;
+        if (reaction > _max_reaction) {
+            _max_reaction = reaction;
+        }
+        gr::thread::scoped_lock lock(_mutex);
+        _total_reaction += reaction;
+        _reactions++;
+    }
+
+    pmt::pmt_t meta = pmt::make_dict();
+    meta = pmt::dict_add(meta, pmt::mp("detect_freq"), pmt::from_double(d.freq));
+    meta = pmt::dict_add(meta, pmt::mp("detect_level"), pmt::from_double(d.level));
+    meta = pmt::dict_add(meta, pmt::mp("detect_excess"), pmt::from_double(d.excess));
+    meta = pmt::dict_add(meta, pmt::mp("detect_ns"), pmt::from_long(detect_ns));
+    meta = pmt::dict_add(meta, pmt::mp("reaction_time"), pmt::from_double(reaction));
+    meta = pmt::dict_add(meta, pmt::mp("segment"), pmt::from_long(segment));
+    meta = pmt::dict_add(meta, pmt::mp("rx_freq"), pmt::from_double(d.freq));
+    meta = pmt::dict_add(meta, pmt::mp("rx_rate"), pmt::from_double(_rate));
+    meta = pmt::dict_add(meta, pmt::mp("bandwidth"), pmt::from_double(_bandwidth));
+    meta = pmt::dict_add(meta, pmt::mp("ns_since_epoch"), pmt::from_long(ns));
+    meta = pmt::dict_add(meta, pmt::mp("sample_loss"), pmt::from_bool(loss));
+    message_port_pub(pmt::mp("captures"),
+                     pmt::cons(meta, pmt::init_c32vector(_iq.size(), _iq.data())));
+    _captures++;
+}
+
+void sm_cue_capture_impl::capture_segmented(const detection& d, int64_t detect_ns, int len)
+{
+    // One segment, triggered immediately, at the full segmented capture rate
+    ERROR_CHECK("smSetSegIQDataType", smSetSegIQDataType(_handle, smDataType32fc));
+    ERROR_CHECK("smSetSegIQCenterFreq", smSetSegIQCenterFreq(_handle, d.freq));
+    ERROR_CHECK("smSetSegIQSegmentCount", smSetSegIQSegmentCount(_handle, 1));
+    ERROR_CHECK("smSetSegIQSegment",
+                smSetSegIQSegment(_handle, 0, smTriggerTypeImm, 0, len, SEGMENT_TIMEOUT));
+    ERROR_CHECK("smConfigure", smConfigure(_handle, smModeIQSegmentedCapture));
+    ERROR_CHECK("smGetIQParameters", smGetIQParameters(_handle, &_rate, &_bandwidth));
+
+    _iq.resize(len);
+    int64_t ns = 0;
+    ERROR_CHECK("smSegIQCaptureStart", smSegIQCaptureStart(_handle, 0));
+    ERROR_CHECK("smSegIQCaptureWait", smSegIQCaptureWait(_handle, 0));
+    ERROR_CHECK("smSegIQCaptureTime", smSegIQCaptureTime(_handle, 0, 0, &ns));
+    ERROR_CHECK("smSegIQCaptureRead", smSegIQCaptureRead(_handle, 0, 0, _iq.data(), 0, len));
+    ERROR_CHECK("smSegIQCaptureFinish", smSegIQCaptureFinish(_handle, 0));
+
+    publish(d, detect_ns, ns, 0, false);
+}
+
+void sm_cue_capture_impl::capture_streaming(const detection& d,
+                                            int64_t detect_ns,
+                                            int len,
+                                            int decimation,
+                                            double dwell)
+{
+    typedef std::chrono::steady_clock clock;
+
+    ERROR_CHECK("smSetIQDataType", smSetIQDataType(_handle, smDataType32fc));
+    ERROR_CHECK("smSetIQCenterFreq", smSetIQCenterFreq(_handle, d.freq));
+    ERROR_CHECK("smSetIQSampleRate", smSetIQSampleRate(_handle, decimation));
+    ERROR_CHECK("smSetIQBandwidth",
+                smSetIQBandwidth(_handle, smTrue, IQ_BANDWIDTH * BASE_RATE / decimation));
+    ERROR_CHECK("smConfigure", smConfigure(_handle, smModeIQStreaming));
+    ERROR_CHECK("smGetIQParameters", smGetIQParameters(_handle, &_rate, &_bandwidth));
+
+    _iq.resize(len);
+    clock::time_point until = clock::now() + std::chrono::duration_cast<clock::duration>(
+                                                 std::chrono::duration<double>(dwell));
+    int segment = 0;
+    do {
+        int64_t ns = 0;
+        int loss = 0;
+        ERROR_CHECK("smGetIQ",
+                    smGetIQ(_handle,
+                            _iq.data(),
+                            len,
+                            0,
+                            0,
+                            &ns,
+                            segment == 0 ? smTrue : smFalse,
+                            &loss,
+                            0));
+        publish(d, detect_ns, ns, segment, loss != 0);
+        segment++;
+    } while (_running && clock::now() < until);
+}
+
+void sm_cue_capture_impl::capture(const detection& d, int64_t detect_ns)
+{
+    int len, decimation;
+    bool streaming;
+    double dwell;
+    {
+        gr::thread::scoped_lock lock(_mutex);
+        len = _capture_len;
+        decimation = _decimation;
+        streaming = _streaming;
+        dwell = _dwell;
+        ERROR_CHECK("smSetRefLevel", smSetRefLevel(_handle, _reflevel));
+    }
+
+    if (streaming) {
+        capture_streaming(d, detect_ns, len, decimation, dwell);
+    } else {
+        capture_segmented(d, detect_ns, len);
+    }
+}
+
+void sm_cue_capture_impl::run()
+{
+    while (_running) {
+        configure_sweep();
+
+        int64_t ns = 0;
+        ERROR_CHECK("smGetSweep", smGetSweep(_handle, nullptr, _sweep.bins.data(), &ns));
+        _sweep.ns_since_epoch = ns;
+        _sweeps++;
+        message_port_pub(pmt::mp("sweeps"), _sweep.to_pdu());
+
+        detect();
+        for (const detection& d : _detections) {
+            if (!_running) {
+                break;
+            }
+            capture(d, ns);
+        }
+    }
+}
+
+bool sm_cue_capture_impl::start()
+{
+    _open->wait();
+    _sweeps = 0;
+    _captures = 0;
+    _last_reaction = 0.0;
+    _max_reaction = 0.0;
+    _total_reaction = 0.0;
+    _reactions = 0;
+    _running = true;
+    _thread = std::thread(&sm_cue_capture_impl::run, this);
+    return sm_cue_capture::start();
+}
+
+bool sm_cue_capture_impl::stop()
+{
+    _running = false;
+    if (_thread.joinable()) {
+        _thread.join();
+        if (_handle >= 0) {
+            smAbort(_handle);
+        }
+    }
+    return sm_cue_capture::stop();
+}
+
+} /* namespace signal_hound */
+} /* namespace gr */
@@ -0,0 +1,114 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SM_CUE_CAPTURE_IMPL_H
+#define INCLUDED_SIGNAL_HOUND_SM_CUE_CAPTURE_IMPL_H
+
+#include "device_open.h"
+#include "limit_mask.h"
+#include "sweep_pdu.h"
+#include <gnuradio/signal_hound/sm_api.h>
+#include <gnuradio/signal_hound/sm_cue_capture.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+class sm_cue_capture_impl : public sm_cue_capture
+{
+private:
+    struct detection {
+        double freq;
+        float level;
+        float excess;
+    };
+
+    int _handle;
+    std::unique_ptr<device_open> _open;
+
+    // Written by the setters, read by the device thread under _mutex
+    double _start, _stop, _rbw, _reflevel;
+    limit_mask _mask;
+    int _capture_len, _decimation;
+    bool _streaming;
+    int _max_captures;
+    double _holdoff, _dwell;
+    gr::thread::mutex _mutex;
+    bool _sweep_changed;
+
+    // Device thread state
+    sweep_trace _sweep;
+    mask_compare _compare;
+    std::vector<detection> _detections;
+    std::vector<std::pair<double, int64_t>> _recent;
+    std::vector<gr_complex> _iq;
+    double _rate, _bandwidth;
+
+    std::thread _thread;
+    std::atomic<bool> _running;
+    std::atomic<uint64_t> _sweeps;
+    std::atomic<uint64_t> _captures;
+    std::atomic<double> _last_reaction;
+    std::atomic<double> _max_reaction;
+    double _total_reaction;
+    uint64_t _reactions;
+
+    void configure_sweep(void);
+    void detect(void);
+    void capture(const detection& d, int64_t detect_ns);
+    void capture_segmented(const detection& d, int64_t detect_ns, int len);
+    void capture_streaming(
+        const detection& d, int64_t detect_ns, int len, int decimation, double dwell);
+    void publish(const detection& d, int64_t detect_ns, int64_t ns, int segment, bool loss);
+    void run(void);
+
+public:
+    sm_cue_capture_impl(double start,
+                        double stop,
+                        double rbw,
+                        double reflevel,
+                        double threshold,
+                        int capture_len,
+                        int decimation,
+                        const std::string& mode,
+                        int max_captures,
+                        double holdoff,
+                        double dwell,
+                        const std::string& type,
+                        const std::string& hostAddr,
+                        const std::string& deviceAddr,
+                        uint16_t port);
+    ~sm_cue_capture_impl();
+
+    void set_span(double start, double stop);
+    void set_rbw(double rbw);
+    void set_reflevel(double reflevel);
+    void set_threshold(double threshold);
+    void set_mask(const std::vector<double>& freqs, const std::vector<double>& levels);
+    void set_capture(int capture_len, int decimation);
+    void set_mode(const std::string& mode);
+    void set_max_captures(int max_captures);
+    void set_holdoff(double holdoff);
+    void set_dwell(double dwell);
+
+    uint64_t sweeps();
+    uint64_t captures();
+    double last_reaction_time();
+    double mean_reaction_time();
+    double max_reaction_time();
+
+    bool start(void);
+    bool stop(void);
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SM_CUE_CAPTURE_IMPL_H */
@@ -6,11 +6,19 @@
  */
 
 #include "sm_series_impl.h"
+#include "trace_span.h"
 #include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
 
 namespace gr {
     namespace signal_hound {
-        static SmDeviceType SMStringToType(std::string typeString)
+        // Length of one SM200/SM435 USB transfer, the unit smSetIQQueueSize
+        // counts in. Reads are aligned to the samples it carries.
+        static const double DEVICE_TRANSFER = 2.62e-3;
+
+        SmDeviceType SMStringToType(std::string typeString)
         {
             SmDeviceType type = smDeviceTypeSM200A;
             if (typeString == "SM200A") {
@@ -27,6 +35,10 @@ namespace gr {
             return type;
         }
 
+        // Optional outputs after the first run at 1/4, 1/16 and 1/64 of the rate
+        static const int DISPLAY_PORTS = 3;
+        static const int PYRAMID_TAPS = 47;
+
         using output_type = gr_complex;
         sm_series::sptr sm_series::make(double center, 
                                         double reflevel, 
@@ -38,10 +50,15 @@ namespace gr {
                                         std::string type,
                                         std::string hostAddr,
                                         std::string deviceAddr,
-                                        uint16_t port)
+                                        uint16_t port,
+                                        double idle_timeout,
+                                        std::string replay,
+                                        bool replay_paced,
+                                        int vlen,
+                                        int overlap)
         {
             return gnuradio::make_block_sptr<sm_series_impl>(
-                center, reflevel, atten, decimation, swfilter, purge, bandwidth, type, hostAddr, deviceAddr, port);
+                center, reflevel, atten, decimation, swfilter, purge, bandwidth, type, hostAddr, deviceAddr, port, idle_timeout, replay, replay_paced, vlen, overlap);
         }
 
         void ERROR_CHECK(const char* call, SmStatus status)
@@ -70,10 +87,15 @@ namespace gr {
                                        std::string type,
                                        std::string hostAddr,
                                        std::string deviceAddr,
-                                       uint16_t port) : 
+                                       uint16_t port,
+                                       double idle_timeout,
+                                       std::string replay,
+                                       bool replay_paced,
+                                       int vlen,
+                                       int overlap) : 
             gr::sync_block("sm_series", 
                            gr::io_signature::make(0, 0, 0),
-                           gr::io_signature::make(1 /* min outputs */, 1 /*max outputs */, sizeof(output_type))),
+                           gr::io_signature::make(1 /* min outputs */, vlen > 1 ? 1 : 1 + DISPLAY_PORTS /*max outputs */, sizeof(output_type) * vlen)),
             _handle(-1),
             _center(center),
             _reflevel(reflevel),
@@ -87,25 +109,51 @@ namespace gr {
             _deviceAddr(deviceAddr),
             _port(port),
             _param_changed(true),
-            _buffer(0),
-            _len(0)
+            _frames(vlen, overlap),
+            _overruns(0),
+            _serial(0),
+            _vrt_samples_per_packet(0),
+            _read_latency(0.002),
+            _output_rate(0.0),
+            _lte_rate(false),
+            _tag_config(true)
         {
             std::cout << "\nAPI Version: " << smGetAPIVersion() << std::endl;
 
-            // Open device
-            if(_type == smDeviceTypeSM200A ||
-               _type == smDeviceTypeSM200B ||
-               _type == smDeviceTypeSM435B) {
-                ERROR_CHECK("smOpenDevice", smOpenDevice(&_handle));
+            // Open device in the background, start() waits for it. The
+            // address setters may run meanwhile, so open with copies.
+            SmDeviceType openType = _type;
+            if(!replay.empty()) {
+                _open.reset(new device_open("SM replay", [this, replay, replay_paced]() {
+                    _replay.reset(new file_device(replay, replay_paced));
+                }));
             } else {
-                 std::cout << "smOpenNetworkedDevice(" << std::to_string(_handle) << "," << _hostAddr.c_str() << "," << _deviceAddr.c_str() << "," << std::to_string(port) << ")" << std::endl;
-                ERROR_CHECK("smOpenNetworkedDevice", smOpenNetworkedDevice(&_handle, _hostAddr.c_str(), _deviceAddr.c_str(), _port));
+                _open.reset(new device_open("SM", [this, openType, hostAddr, deviceAddr, port]() {
+                    if(openType == smDeviceTypeSM200A ||
+                       openType == smDeviceTypeSM200B ||
+                       openType == smDeviceTypeSM435B) {
+                        ERROR_CHECK("smOpenDevice", smOpenDevice(&_handle));
+                    } else {
+                         std::cout << "smOpenNetworkedDevice(" << std::to_string(_handle) << "," << hostAddr.c_str() << "," << deviceAddr.c_str() << "," << std::to_string(port) << ")" << std::endl;
+                        ERROR_CHECK("smOpenNetworkedDevice", smOpenNetworkedDevice(&_handle, hostAddr.c_str(), deviceAddr.c_str(), port));
+                    }
+
+                    int serial;
+                    SmDeviceType dtype;
+                    ERROR_CHECK("smGetDeviceInfo", smGetDeviceInfo(_handle, &dtype, &serial));
+                    std::cout << "Serial Number: "<< serial << std::endl;
+                    _serial = serial;
+                }));
             }
 
-            int serial;
-            SmDeviceType dtype;
-            ERROR_CHECK("smGetDeviceInfo", smGetDeviceInfo(_handle, &dtype, &serial));
-            std::cout << "Serial Number: "<< serial << std::endl;
+            _power.reset(new power_manager([this]() { enter_standby(); },
+                                           [this]() { leave_standby(); }));
+            _power->set_idle_timeout(idle_timeout);
+
+            reserve_read_chunk(this, _frames.step());
+            message_port_register_out(pmt::mp("pdus"));
+
+            _pyramid.reset(new halfband_pyramid(2 * DISPLAY_PORTS, PYRAMID_TAPS));
         }
 
         /*
@@ -113,9 +161,12 @@ namespace gr {
          */
         sm_series_impl::~sm_series_impl()
         {
-            smAbort(_handle);
-            smCloseDevice(_handle);
-            if (_buffer) delete [] _buffer;
+            _power.reset();
+            _open.reset();
+            if(_handle >= 0) {
+                smAbort(_handle);
+                smCloseDevice(_handle);
+            }
         }
 
 
@@ -195,32 +246,272 @@ namespace gr {
             _param_changed = true;
         }
 
-        void sm_series_impl::configure()
+        void sm_series_impl::set_idle_timeout(double seconds)
+        {
+            _power->set_idle_timeout(seconds);
+        }
+
+        void sm_series_impl::prewake()
+        {
+            _power->prewake();
+        }
+
+        double sm_series_impl::wake_latency()
+        {
+            return _power->wake_latency();
+        }
+
+        uint64_t sm_series_impl::overruns()
+        {
+            return _overruns;
+        }
+
+        void sm_series_impl::set_vrt_destination(const std::string& destination,
+                                                  int samples_per_packet)
+        {
+            // The stream ID is the serial number. While the device is still
+            // opening, start() sets the sender up instead of waiting here.
+            gr::thread::scoped_lock lock(_mutex);
+            _vrt_destination = destination;
+            _vrt_samples_per_packet = samples_per_packet;
+            _vrt.reset();
+            if(_open->ready()) {
+                apply_vrt_destination();
+            }
+        }
+
+        void sm_series_impl::apply_vrt_destination()
+        {
+            if(!_vrt && !_vrt_destination.empty()) {
+                _vrt.reset(new vrt_sender(_vrt_destination, _vrt_samples_per_packet, _serial));
+            }
+        }
+
+        void sm_series_impl::set_shm_publish(const std::string& name, int capacity)
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            _shm.reset();
+            if(!name.empty()) {
+                _shm.reset(new shm_ring_writer(name, capacity));
+            }
+        }
+
+        void sm_series_impl::set_recording(const std::string& path,
+                                           int mantissa_bits,
+                                           double max_error)
+        {
+            std::unique_ptr<bfp_file_writer> recording;
+            {
+                gr::thread::scoped_lock lock(_mutex);
+                recording.swap(_recording);
+            }
+            // Closing waits for the writer to drain, keep work() running meanwhile
+            recording.reset();
+            if(!path.empty()) {
+                recording.reset(new bfp_file_writer(path, mantissa_bits, max_error));
+                gr::thread::scoped_lock lock(_mutex);
+                _recording.swap(recording);
+            }
+        }
+
+        void sm_series_impl::set_pdu_output(int samples_per_pdu, int pool_size)
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            _pdus.reset();
+            if(samples_per_pdu > 0) {
+                _pdus.reset(new pdu_pool(samples_per_pdu, pool_size, [this](const pmt::pmt_t& pdu) {
+                    message_port_pub(pmt::mp("pdus"), pdu);
+                }));
+            }
+        }
+
+        void sm_series_impl::set_read_latency(double seconds)
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            _read_latency = seconds;
+            _param_changed = true;
+        }
+
+        // Decimation is a power of two up to this, per base rate
+        static int max_decimation(bool lte)
+        {
+            // 61.44 MS/s down to 1.92 MS/s, the 1.4 MHz LTE channel rate
+            return lte ? 32 : 4096;
+        }
+
+        void sm_series_impl::set_base_rate(const std::string& base)
+        {
+            if(base != "native" && base != "lte") {
+                throw std::invalid_argument("sm_series: unknown base rate " + base);
+            }
+
+            gr::thread::scoped_lock lock(_mutex);
+            _lte_rate = base == "lte";
+            _param_changed = true;
+        }
+
+        std::vector<int> sm_series_impl::valid_decimations()
         {
             gr::thread::scoped_lock lock(_mutex);
+            std::vector<int> decimations;
+            for(int d = 1; d <= max_decimation(_lte_rate); d *= 2) {
+                decimations.push_back(d);
+            }
+            return decimations;
+        }
+
+        void sm_series_impl::set_output_rate(double rate)
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            _output_rate = rate;
+            _param_changed = true;
+        }
 
-            // Configure
-            ERROR_CHECK("smSetIQDataType", smSetIQDataType(_handle, smDataType32fc));
-            ERROR_CHECK("smSetIQCenterFreq", smSetIQCenterFreq(_handle, _center));
-            ERROR_CHECK("smSetIQSampleRate", smSetIQSampleRate(_handle, _decimation));
-            ERROR_CHECK("smSetRefLevel", smSetRefLevel(_handle, _reflevel));
-            ERROR_CHECK("smSetAttenuator", smSetAttenuator(_handle, _atten));
-            ERROR_CHECK("smSetIQBandwidth", smSetIQBandwidth(_handle, _swfilter, _bandwidth));
+        void sm_series_impl::enter_standby()
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            if(_replay || _handle < 0) {
+                return;
+            }
+            smAbort(_handle);
+            ERROR_CHECK("smSetPowerState", smSetPowerState(_handle, smPowerStateStandby));
+        }
+
+        void sm_series_impl::leave_standby()
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            if(!_replay && _handle >= 0) {
+                ERROR_CHECK("smSetPowerState", smSetPowerState(_handle, smPowerStateOn));
+            }
+            _param_changed = true;
+        }
+
+        bool sm_series_impl::start()
+        {
+            _open->wait();
+            {
+                gr::thread::scoped_lock lock(_mutex);
+                apply_vrt_destination();
+            }
+            _power->active();
+            return sm_series::start();
+        }
+
+        bool sm_series_impl::stop()
+        {
+            // Stop the API streaming threads while the flowgraph is idle,
+            // the next work() reconfigures the device.
+            {
+                gr::thread::scoped_lock lock(_mutex);
+                if(_handle >= 0) {
+                    smAbort(_handle);
+                }
+                _param_changed = true;
+            }
+            _power->idle();
+            return sm_series::stop();
+        }
+
+        void sm_series_impl::configure()
+        {
+            SH_TRACE("config", "sm_series::configure");
+            gr::thread::scoped_lock lock(_mutex);
 
-            // Initiate for I/Q streaming
-            ERROR_CHECK("smConfigure", smConfigure(_handle, smModeIQStreaming));
+            double baseRate = _lte_rate ? 61.44e6 : 50.0e6;
+            int decimation = _output_rate > 0.0 ? rate_converter::pick_decimation(baseRate, _output_rate, max_decimation(_lte_rate)) : _decimation;
+            if(decimation < 1 || decimation > max_decimation(_lte_rate) || (decimation & (decimation - 1))) {
+                std::cout << "** Decimation " << decimation << " is not valid for the "
+                          << (_lte_rate ? "LTE" : "native") << " base rate **" << std::endl;
+            }
 
-            // Get I/Q streaming info
+            double center = _center;
             double sampleRate, actualBandwidth;
-            ERROR_CHECK("smGetIQParameters", smGetIQParameters(_handle, &sampleRate, &actualBandwidth));
+            if(_replay) {
+                center = _replay->configure(_center, baseRate / decimation, _bandwidth, sampleRate, actualBandwidth);
+            } else {
+                // Configure
+                ERROR_CHECK("smSetIQDataType", smSetIQDataType(_handle, smDataType32fc));
+                ERROR_CHECK("smSetIQCenterFreq", smSetIQCenterFreq(_handle, _center));
+                ERROR_CHECK("smSetIQBaseSampleRate", smSetIQBaseSampleRate(_handle, _lte_rate ? smIQStreamSampleRateLTE : smIQStreamSampleRateNative));
+                ERROR_CHECK("smSetIQSampleRate", smSetIQSampleRate(_handle, decimation));
+                ERROR_CHECK("smSetRefLevel", smSetRefLevel(_handle, _reflevel));
+                ERROR_CHECK("smSetAttenuator", smSetAttenuator(_handle, _atten));
+                ERROR_CHECK("smSetIQBandwidth", smSetIQBandwidth(_handle, _swfilter, _bandwidth));
+
+                // Initiate for I/Q streaming
+                ERROR_CHECK("smConfigure", smConfigure(_handle, smModeIQStreaming));
+
+                // Get I/Q streaming info
+                ERROR_CHECK("smGetIQParameters", smGetIQParameters(_handle, &sampleRate, &actualBandwidth));
+            }
             std::cout << "\nSample Rate: "<< sampleRate << std::endl;
             std::cout << "Actual Bandwidth: "<< actualBandwidth << std::endl;
+
+            // Finish at the requested rate in software
+            _resampler.reset();
+            if(_output_rate > 0.0) {
+                _resampler.reset(new rate_converter(sampleRate, _output_rate));
+                sampleRate = _output_rate;
+                actualBandwidth = std::min(actualBandwidth, 0.8 * _output_rate);
+            }
+
+            _info.center = center;
+            _info.sample_rate = sampleRate;
+            _info.bandwidth = actualBandwidth;
+            _info.reflevel = _reflevel;
+
+            apply_read_chunk(this,
+                             sampleRate,
+                             (int)(sampleRate * DEVICE_TRANSFER),
+                             _read_latency,
+                             _frames.step());
+            _frames.reset();
+
+            _tag_config = true;
+            _pyramid->reset();
+        }
+
+        void sm_series_impl::read_iq(gr_complex* buf, int n, int64_t& ns_since_epoch, int& loss)
+        {
+            SH_TRACE("device", "smGetIQ");
+            if(_replay) {
+                _replay->read(buf, n, _purge == smTrue, ns_since_epoch, loss);
+                return;
+            }
+            ERROR_CHECK("smGetIQ", smGetIQ(_handle, buf, n, 0, 0, &ns_since_epoch, _purge ? smTrue : smFalse, &loss, 0));
+        }
+
+        void sm_series_impl::read_output(gr_complex* buf, int n, int64_t& ns_since_epoch, int& loss)
+        {
+            // Through the resampler when an output rate is set
+            if(!_resampler) {
+                read_iq(buf, n, ns_since_epoch, loss);
+                return;
+            }
+
+            SH_TRACE("convert", "resample");
+            // Time the first output sample from the first read behind it
+            int64_t lead = (int64_t)(_resampler->buffered() * 1.0e9);
+            bool first = true;
+            ns_since_epoch = 0;
+            loss = 0;
+            _resampler->resample(buf, n, [&](gr_complex* in, int m) {
+                int64_t ns = 0;
+                int lost = 0;
+                read_iq(in, m, ns, lost);
+                if(first && ns) {
+                    ns_since_epoch = ns - lead;
+                }
+                first = false;
+                loss |= lost;
+            });
         }
 
         int sm_series_impl::work(int noutput_items,
                                  gr_vector_const_void_star &input_items,
                                  gr_vector_void_star &output_items) 
         {
+            SH_TRACE("work", "sm_series::work");
             auto out = static_cast<output_type*>(output_items[0]);
 
             // Initiate new configuration if necessary
@@ -229,19 +520,60 @@ namespace gr {
                 _param_changed = false;
             }
 
-            // Allocate memory if necessary
-            if(!_buffer || noutput_items != _len) {
-                if(_buffer) delete [] _buffer;
-                _buffer = new std::complex<float>[noutput_items];
-                _len = noutput_items;
+            // Get I/Q, whole frames of it when vlen is set
+            int nsamples = 0;
+            int64_t nsSinceEpoch = 0;
+            int sampleLoss = 0;
+            int lead = 0;
+            const gr_complex* samples = _frames.build(out, noutput_items, [this](gr_complex* buf, int n, int64_t& ns, int& loss) {
+                read_output(buf, n, ns, loss);
+            }, nsamples, nsSinceEpoch, sampleLoss, lead);
+
+            if(sampleLoss) {
+                _overruns++;
+            }
+
+            // Describe the stream after every reconfiguration
+            int ports = output_items.size();
+            if(_tag_config) {
+                for(int p = 0; p < ports; p++) {
+                    add_item_tag(p, nitems_written(p), pmt::mp("rx_rate"), pmt::from_double(_info.sample_rate / (1 << (2 * p))));
+                    add_item_tag(p, nitems_written(p), pmt::mp("rx_freq"), pmt::from_double(_info.center));
+                }
+                _tag_config = false;
             }
 
-            // Get I/Q
-            ERROR_CHECK("smGetIQ", smGetIQ(_handle, _buffer, noutput_items, 0, 0, 0, _purge ? smTrue : smFalse, 0, 0));
+            // Forward to the network, shared memory and disk from here, avoiding a scheduler hop
+            {
+                SH_TRACE("forward", "forward");
+                gr::thread::scoped_lock lock(_mutex);
+                _info.ns_since_epoch = nsSinceEpoch;
+                _info.sample_loss = sampleLoss != 0;
+                if(_vrt) {
+                    _vrt->send(samples, nsamples, _info);
+                }
+                if(_shm) {
+                    _shm->write(samples, nsamples, _info);
+                }
+                if(_recording) {
+                    _recording->write(samples, nsamples, _info);
+                }
+                if(_pdus) {
+                    _pdus->write(samples, nsamples, _info);
+                }
+            }
 
-            // Move data to output array
-            for(int i = 0; i < noutput_items; i++) {
-                out[i] =  _buffer[i];
+            // Display ports, the pyramid only runs as deep as the last connected one
+            if(ports > 1) {
+                SH_TRACE("convert", "pyramid");
+                _pyramid->process(samples, nsamples, 2 * (ports - 1));
+                for(int p = 1; p < ports; p++) {
+                    int n = _pyramid->count(2 * p);
+                    memcpy(output_items[p], _pyramid->level(2 * p), n * sizeof(output_type));
+                    produce(p, n);
+                }
+                produce(0, noutput_items);
+                return WORK_CALLED_PRODUCE;
             }
 
             return noutput_items;
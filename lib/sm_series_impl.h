@@ -10,6 +10,20 @@
 
 #include <gnuradio/signal_hound/sm_series.h>
 #include <gnuradio/signal_hound/sm_api.h>
+#include "halfband.h"
+#include "device_open.h"
+#include "file_device.h"
+#include "frame_builder.h"
+#include "pdu_pool.h"
+#include "power_manager.h"
+#include "rate_converter.h"
+#include "read_chunk.h"
+#include "stream_info.h"
+#include "bfp_file.h"
+#include "shm_ring.h"
+#include "vrt_sender.h"
+#include <atomic>
+#include <memory>
 
 namespace gr {
     namespace signal_hound {
@@ -31,9 +45,35 @@ namespace gr {
                 gr::thread::mutex _mutex;
                 bool _param_changed;
 
-                std::complex<float> *_buffer;
-                int _len;
+                frame_builder _frames;
 
+                std::unique_ptr<device_open> _open;
+                std::unique_ptr<file_device> _replay;
+                std::atomic<uint64_t> _overruns;
+                std::unique_ptr<power_manager> _power;
+
+                uint32_t _serial;
+                stream_info _info;
+                std::unique_ptr<vrt_sender> _vrt;
+                std::string _vrt_destination; // applied once the device is open
+                int _vrt_samples_per_packet;
+                std::unique_ptr<shm_ring_writer> _shm;
+                std::unique_ptr<bfp_file_writer> _recording;
+                std::unique_ptr<pdu_pool> _pdus;
+
+                double _read_latency;
+
+                double _output_rate;
+                std::unique_ptr<rate_converter> _resampler;
+
+                bool _lte_rate;
+                bool _tag_config;
+
+                std::unique_ptr<halfband_pyramid> _pyramid;
+
+                void apply_vrt_destination(void);
+                void enter_standby(void);
+                void leave_standby(void);
 
             public:
                 sm_series_impl(double center, 
@@ -46,7 +86,12 @@ namespace gr {
                                std::string type,
                                std::string hostAddr,
                                std::string deviceAddr,
-                               uint16_t port);
+                               uint16_t port,
+                               double idle_timeout,
+                               std::string replay,
+                               bool replay_paced,
+                               int vlen,
+                               int overlap);
                 ~sm_series_impl(void);
 
                 void set_center(double center);
@@ -61,8 +106,30 @@ namespace gr {
                 void set_deviceAddr(std::string deviceAddr);
                 void set_port(uint16_t port);
 
+                void set_idle_timeout(double seconds);
+                void prewake(void);
+                double wake_latency(void);
+                uint64_t overruns(void);
+
+                void set_vrt_destination(const std::string& destination,
+                                         int samples_per_packet);
+                void set_shm_publish(const std::string& name, int capacity);
+                void set_recording(const std::string& path,
+                                   int mantissa_bits,
+                                   double max_error);
+                void set_pdu_output(int samples_per_pdu, int pool_size);
+                void set_read_latency(double seconds);
+                void set_output_rate(double rate);
+                void set_base_rate(const std::string& base);
+                std::vector<int> valid_decimations(void);
+
+                void read_iq(gr_complex* buf, int n, int64_t& ns_since_epoch, int& loss);
+                void read_output(gr_complex* buf, int n, int64_t& ns_since_epoch, int& loss);
                 void configure(void);
 
+                bool start(void);
+                bool stop(void);
+
                 // Where all the action really happens
                 int work(int noutput_items,
                          gr_vector_const_void_star &input_items,
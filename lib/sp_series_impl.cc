@@ -6,10 +6,18 @@
  */
 
 #include "sp_series_impl.h"
+#include "trace_span.h"
 #include <gnuradio/io_signature.h>
+#include <algorithm>
 
 namespace gr {
     namespace signal_hound {
+        // Length of one SP145 USB transfer, the unit spSetIQQueueSize counts
+        // in. Reads are aligned to the samples it carries.
+        static const double DEVICE_TRANSFER = 2.1e-3;
+        // Undecimated I/Q rate, where set_output_rate() starts its search
+        static const double BASE_RATE = 61.44e6;
+
         using output_type = gr_complex;
         sp_series::sptr sp_series::make(double reflevel,
                                         int atten,
@@ -17,10 +25,15 @@ namespace gr {
                                         int decimation,
                                         bool swfilter,
                                         double bandwidth,
-                                        bool purge) 
+                                        bool purge,
+                                        double idle_timeout,
+                                        std::string replay,
+                                        bool replay_paced,
+                                        int vlen,
+                                        int overlap)
         {
             return gnuradio::make_block_sptr<sp_series_impl>(
-                reflevel, atten, center, decimation, swfilter, bandwidth, purge);
+                reflevel, atten, center, decimation, swfilter, bandwidth, purge, idle_timeout, replay, replay_paced, vlen, overlap);
         }
 
         void ERROR_CHECK(SpStatus status)
@@ -45,10 +58,15 @@ namespace gr {
                                        int decimation, 
                                        bool swfilter, 
                                        double bandwidth, 
-                                       bool purge) : 
+                                       bool purge,
+                                       double idle_timeout,
+                                       std::string replay,
+                                       bool replay_paced,
+                                       int vlen,
+                                       int overlap) : 
             gr::sync_block("sp_series",
             gr::io_signature::make(0, 0, 0),
-            gr::io_signature::make(1 /* min outputs */, 1 /*max outputs */, sizeof(output_type))),
+            gr::io_signature::make(1 /* min outputs */, 1 /*max outputs */, sizeof(output_type) * vlen)),
             _handle(-1),
             _center(center),
             _reflevel(reflevel),
@@ -58,17 +76,37 @@ namespace gr {
             _purge(purge ? spTrue : spFalse),
             _swfilter(swfilter ? spTrue : spFalse),
             _param_changed(true),
-            _buffer(0),
-            _len(0) 
+            _frames(vlen, overlap),
+            _overruns(0),
+            _serial(0),
+            _vrt_samples_per_packet(0),
+            _read_latency(0.002),
+            _output_rate(0.0)
         {
             std::cout << "\nAPI Version: " << spGetAPIVersion() << std::endl;
 
-            // Open device
-            ERROR_CHECK(spOpenDevice(&_handle));
+            // Open device in the background, start() waits for it
+            if(!replay.empty()) {
+                _open.reset(new device_open("SP145 replay", [this, replay, replay_paced]() {
+                    _replay.reset(new file_device(replay, replay_paced));
+                }));
+            } else {
+                _open.reset(new device_open("SP145", [this]() {
+                    ERROR_CHECK(spOpenDevice(&_handle));
+
+                    int serial;
+                    ERROR_CHECK(spGetSerialNumber(_handle, &serial));
+                    std::cout << "Serial Number: "<< serial << std::endl;
+                    _serial = serial;
+                }));
+            }
+
+            _power.reset(new power_manager([this]() { enter_standby(); },
+                                           [this]() { leave_standby(); }));
+            _power->set_idle_timeout(idle_timeout);
 
-            int serial;
-            ERROR_CHECK(spGetSerialNumber(_handle, &serial));
-            std::cout << "Serial Number: "<< serial << std::endl;
+            reserve_read_chunk(this, _frames.step());
+            message_port_register_out(pmt::mp("pdus"));
         }
 
         /*
@@ -76,10 +114,11 @@ namespace gr {
          */
         sp_series_impl::~sp_series_impl() 
         {
-            spAbort(_handle);
-            spCloseDevice(_handle);
-            if (_buffer) {
-                delete [] _buffer;
+            _power.reset();
+            _open.reset();
+            if(_handle >= 0) {
+                spAbort(_handle);
+                spCloseDevice(_handle);
             }
         }
 
@@ -131,33 +170,236 @@ namespace gr {
             _purge = purge ? spTrue : spFalse;
         }
 
-        void sp_series_impl::configure()
+        void sp_series_impl::set_idle_timeout(double seconds)
+        {
+            _power->set_idle_timeout(seconds);
+        }
+
+        void sp_series_impl::prewake()
+        {
+            _power->prewake();
+        }
+
+        double sp_series_impl::wake_latency()
+        {
+            return _power->wake_latency();
+        }
+
+        uint64_t sp_series_impl::overruns()
+        {
+            return _overruns;
+        }
+
+        void sp_series_impl::set_vrt_destination(const std::string& destination,
+                                                  int samples_per_packet)
+        {
+            // The stream ID is the serial number. While the device is still
+            // opening, start() sets the sender up instead of waiting here.
+            gr::thread::scoped_lock lock(_mutex);
+            _vrt_destination = destination;
+            _vrt_samples_per_packet = samples_per_packet;
+            _vrt.reset();
+            if(_open->ready()) {
+                apply_vrt_destination();
+            }
+        }
+
+        void sp_series_impl::apply_vrt_destination()
+        {
+            if(!_vrt && !_vrt_destination.empty()) {
+                _vrt.reset(new vrt_sender(_vrt_destination, _vrt_samples_per_packet, _serial));
+            }
+        }
+
+        void sp_series_impl::set_shm_publish(const std::string& name, int capacity)
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            _shm.reset();
+            if(!name.empty()) {
+                _shm.reset(new shm_ring_writer(name, capacity));
+            }
+        }
+
+        void sp_series_impl::set_recording(const std::string& path,
+                                           int mantissa_bits,
+                                           double max_error)
+        {
+            std::unique_ptr<bfp_file_writer> recording;
+            {
+                gr::thread::scoped_lock lock(_mutex);
+                recording.swap(_recording);
+            }
+            // Closing waits for the writer to drain, keep work() running meanwhile
+            recording.reset();
+            if(!path.empty()) {
+                recording.reset(new bfp_file_writer(path, mantissa_bits, max_error));
+                gr::thread::scoped_lock lock(_mutex);
+                _recording.swap(recording);
+            }
+        }
+
+        void sp_series_impl::set_pdu_output(int samples_per_pdu, int pool_size)
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            _pdus.reset();
+            if(samples_per_pdu > 0) {
+                _pdus.reset(new pdu_pool(samples_per_pdu, pool_size, [this](const pmt::pmt_t& pdu) {
+                    message_port_pub(pmt::mp("pdus"), pdu);
+                }));
+            }
+        }
+
+        void sp_series_impl::set_read_latency(double seconds)
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            _read_latency = seconds;
+            _param_changed = true;
+        }
+
+        void sp_series_impl::set_output_rate(double rate)
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            _output_rate = rate;
+            _param_changed = true;
+        }
+
+        void sp_series_impl::enter_standby()
+        {
+            gr::thread::scoped_lock lock(_mutex);
+            if(_replay || _handle < 0) {
+                return;
+            }
+            spAbort(_handle);
+            ERROR_CHECK(spSetPowerState(_handle, spPowerStateStandby));
+        }
+
+        void sp_series_impl::leave_standby()
         {
             gr::thread::scoped_lock lock(_mutex);
+            if(!_replay && _handle >= 0) {
+                ERROR_CHECK(spSetPowerState(_handle, spPowerStateOn));
+            }
+            _param_changed = true;
+        }
+
+        bool sp_series_impl::start()
+        {
+            _open->wait();
+            {
+                gr::thread::scoped_lock lock(_mutex);
+                apply_vrt_destination();
+            }
+            _power->active();
+            return sp_series::start();
+        }
+
+        bool sp_series_impl::stop()
+        {
+            // Stop the API streaming threads while the flowgraph is idle,
+            // the next work() reconfigures the device.
+            {
+                gr::thread::scoped_lock lock(_mutex);
+                if(_handle >= 0) {
+                    spAbort(_handle);
+                }
+                _param_changed = true;
+            }
+            _power->idle();
+            return sp_series::stop();
+        }
 
-            // Configure
-            ERROR_CHECK(spSetIQDataType(_handle, spDataType32fc));
-            ERROR_CHECK(spSetIQCenterFreq(_handle, _center));
-            ERROR_CHECK(spSetIQSampleRate(_handle, _decimation));
-            ERROR_CHECK(spSetIQSoftwareFilter(_handle, _swfilter));
-            ERROR_CHECK(spSetRefLevel(_handle, _reflevel));
-            ERROR_CHECK(spSetAttenuator(_handle, _atten));
-            ERROR_CHECK(spSetIQBandwidth(_handle, _bandwidth));
+        void sp_series_impl::configure()
+        {
+            SH_TRACE("config", "sp_series::configure");
+            gr::thread::scoped_lock lock(_mutex);
 
-            // Initiate for I/Q streaming
-            ERROR_CHECK(spConfigure(_handle, spModeIQStreaming));
+            int decimation = _output_rate > 0.0 ? rate_converter::pick_decimation(BASE_RATE, _output_rate, SP_MAX_IQ_DECIMATION) : _decimation;
 
-            // Get I/Q streaming info
+            double center = _center;
             double sampleRate, actualBandwidth;
-            ERROR_CHECK(spGetIQParameters(_handle, &sampleRate, &actualBandwidth));
+            if(_replay) {
+                center = _replay->configure(_center, BASE_RATE / decimation, _bandwidth, sampleRate, actualBandwidth);
+            } else {
+                // Configure
+                ERROR_CHECK(spSetIQDataType(_handle, spDataType32fc));
+                ERROR_CHECK(spSetIQCenterFreq(_handle, _center));
+                ERROR_CHECK(spSetIQSampleRate(_handle, decimation));
+                ERROR_CHECK(spSetIQSoftwareFilter(_handle, _swfilter));
+                ERROR_CHECK(spSetRefLevel(_handle, _reflevel));
+                ERROR_CHECK(spSetAttenuator(_handle, _atten));
+                ERROR_CHECK(spSetIQBandwidth(_handle, _bandwidth));
+
+                // Initiate for I/Q streaming
+                ERROR_CHECK(spConfigure(_handle, spModeIQStreaming));
+
+                // Get I/Q streaming info
+                ERROR_CHECK(spGetIQParameters(_handle, &sampleRate, &actualBandwidth));
+            }
             std::cout << "\nSample Rate: "<< sampleRate << std::endl;
             std::cout << "Actual Bandwidth: "<< actualBandwidth << std::endl;
+
+            // Finish at the requested rate in software
+            _resampler.reset();
+            if(_output_rate > 0.0) {
+                _resampler.reset(new rate_converter(sampleRate, _output_rate));
+                sampleRate = _output_rate;
+                actualBandwidth = std::min(actualBandwidth, 0.8 * _output_rate);
+            }
+
+            _info.center = center;
+            _info.sample_rate = sampleRate;
+            _info.bandwidth = actualBandwidth;
+            _info.reflevel = _reflevel;
+
+            apply_read_chunk(this,
+                             sampleRate,
+                             (int)(sampleRate * DEVICE_TRANSFER),
+                             _read_latency,
+                             _frames.step());
+            _frames.reset();
+        }
+
+        void sp_series_impl::read_iq(gr_complex* buf, int n, int64_t& ns_since_epoch, int& loss)
+        {
+            SH_TRACE("device", "spGetIQ");
+            if(_replay) {
+                _replay->read(buf, n, _purge == spTrue, ns_since_epoch, loss);
+                return;
+            }
+            ERROR_CHECK(spGetIQ(_handle, buf, n, 0, 0, &ns_since_epoch, _purge ? spTrue : spFalse, &loss, 0));
+        }
+
+        void sp_series_impl::read_output(gr_complex* buf, int n, int64_t& ns_since_epoch, int& loss)
+        {
+            // Through the resampler when an output rate is set
+            if(!_resampler) {
+                read_iq(buf, n, ns_since_epoch, loss);
+                return;
+            }
+
+            SH_TRACE("convert", "resample");
+            // Time the first output sample from the first read behind it
+            int64_t lead = (int64_t)(_resampler->buffered() * 1.0e9);
+            bool first = true;
+            ns_since_epoch = 0;
+            loss = 0;
+            _resampler->resample(buf, n, [&](gr_complex* in, int m) {
+                int64_t ns = 0;
+                int lost = 0;
+                read_iq(in, m, ns, lost);
+                if(first && ns) {
+                    ns_since_epoch = ns - lead;
+                }
+                first = false;
+                loss |= lost;
+            });
         }
 
         int sp_series_impl::work(int noutput_items,
                                  gr_vector_const_void_star &input_items,
                                  gr_vector_void_star &output_items)
         {
+            SH_TRACE("work", "sp_series::work");
             auto out = static_cast<output_type*>(output_items[0]);
 
             // Initiate new configuration if necessary
@@ -166,19 +408,37 @@ namespace gr {
                 _param_changed = false;
             }
 
-            // Allocate memory if necessary
-            if(!_buffer || noutput_items != _len) {
-                if(_buffer) delete [] _buffer;
-                _buffer = new std::complex<float>[noutput_items];
-                _len = noutput_items;
-            }
+            // Get I/Q, whole frames of it when vlen is set
+            int nsamples = 0;
+            int64_t nsSinceEpoch = 0;
+            int sampleLoss = 0;
+            int lead = 0;
+            const gr_complex* samples = _frames.build(out, noutput_items, [this](gr_complex* buf, int n, int64_t& ns, int& loss) {
+                read_output(buf, n, ns, loss);
+            }, nsamples, nsSinceEpoch, sampleLoss, lead);
 
-            // Get I/Q
-            ERROR_CHECK(spGetIQ(_handle, _buffer, noutput_items, 0, 0, 0, _purge ? spTrue : spFalse, 0, 0));
+            if(sampleLoss) {
+                _overruns++;
+            }
 
-            // Move data to output array
-            for(int i = 0; i < noutput_items; i++) {
-                out[i] =  _buffer[i];
+            // Forward to the network, shared memory and disk from here, avoiding a scheduler hop
+            {
+                SH_TRACE("forward", "forward");
+                gr::thread::scoped_lock lock(_mutex);
+                _info.ns_since_epoch = nsSinceEpoch;
+                _info.sample_loss = sampleLoss != 0;
+                if(_vrt) {
+                    _vrt->send(samples, nsamples, _info);
+                }
+                if(_shm) {
+                    _shm->write(samples, nsamples, _info);
+                }
+                if(_recording) {
+                    _recording->write(samples, nsamples, _info);
+                }
+                if(_pdus) {
+                    _pdus->write(samples, nsamples, _info);
+                }
             }
 
             return noutput_items;
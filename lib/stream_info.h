@@ -0,0 +1,49 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_STREAM_INFO_H
+#define INCLUDED_SIGNAL_HOUND_STREAM_INFO_H
+
+#include <cstdint>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Description of a block of I/Q samples read from a device, shared
+ * by everything that forwards samples outside of the flowgraph.
+ */
+struct stream_info {
+    double center;          //!< Center frequency in Hz
+    double sample_rate;     //!< Samples per second
+    double bandwidth;       //!< IF bandwidth in Hz
+    double reflevel;        //!< Reference level in dBm
+    int64_t ns_since_epoch; //!< Time of the first sample, 0 if unknown
+    bool sample_loss;       //!< Samples were dropped before this block
+
+    stream_info()
+        : center(0.0),
+          sample_rate(0.0),
+          bandwidth(0.0),
+          reflevel(0.0),
+          ns_since_epoch(0),
+          sample_loss(false)
+    {
+    }
+
+    //! True if the tuning described by the two blocks differs
+    bool tuning_differs(const stream_info& other) const
+    {
+        return center != other.center || sample_rate != other.sample_rate ||
+               bandwidth != other.bandwidth || reflevel != other.reflevel;
+    }
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_STREAM_INFO_H */
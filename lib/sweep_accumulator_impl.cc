@@ -0,0 +1,159 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "sweep_accumulator_impl.h"
+#include <gnuradio/io_signature.h>
+#include <stdexcept>
+
+namespace gr {
+namespace signal_hound {
+
+static trace_accumulator::average_mode parse_average(const std::string& average)
+{
+    if (average == "linear") {
+        return trace_accumulator::AVERAGE_LINEAR;
+    } else if (average == "exponential") {
+        return trace_accumulator::AVERAGE_EXPONENTIAL;
+    }
+    throw std::invalid_argument("sweep_accumulator: average must be linear or exponential");
+}
+
+sweep_accumulator::sptr sweep_accumulator::make(const std::string& average,
+                                                double alpha,
+                                                double threshold,
+                                                double interval,
+                                                bool reset_on_snapshot)
+{
+    return gnuradio::make_block_sptr<sweep_accumulator_impl>(
+        average, alpha, threshold, interval, reset_on_snapshot);
+}
+
+
+/*
+ * The private constructor
+ */
+sweep_accumulator_impl::sweep_accumulator_impl(const std::string& average,
+                                               double alpha,
+                                               double threshold,
+                                               double interval,
+                                               bool reset_on_snapshot)
+    : gr::block("sweep_accumulator",
+                gr::io_signature::make(0, 0, 0),
+                gr::io_signature::make(0, 0, 0)),
+      _acc(parse_average(average), alpha, threshold),
+      _interval(interval),
+      _reset_on_snapshot(reset_on_snapshot),
+      _window_start(0),
+      _last_snapshot(clock::now())
+{
+    message_port_register_in(pmt::mp("sweeps"));
+    set_msg_handler(pmt::mp("sweeps"), [this](const pmt::pmt_t& msg) { handle_sweep(msg); });
+
+    message_port_register_out(pmt::mp("max_hold"));
+    message_port_register_out(pmt::mp("min_hold"));
+    message_port_register_out(pmt::mp("average"));
+    message_port_register_out(pmt::mp("occupancy"));
+}
+
+/*
+ * Our virtual destructor.
+ */
+sweep_accumulator_impl::~sweep_accumulator_impl() {}
+
+void sweep_accumulator_impl::set_average(const std::string& average, double alpha)
+{
+    trace_accumulator::average_mode mode = parse_average(average);
+    gr::thread::scoped_lock lock(_mutex);
+    _acc.set_average(mode, alpha);
+}
+
+void sweep_accumulator_impl::set_threshold(double threshold)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _acc.set_threshold(threshold);
+}
+
+void sweep_accumulator_impl::set_interval(double interval)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _interval = interval;
+}
+
+void sweep_accumulator_impl::set_reset_on_snapshot(bool reset_on_snapshot)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _reset_on_snapshot = reset_on_snapshot;
+}
+
+void sweep_accumulator_impl::reset()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _acc.reset(_acc.bins());
+}
+
+uint64_t sweep_accumulator_impl::sweeps()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _acc.count();
+}
+
+void sweep_accumulator_impl::publish(const char* port,
+                                     const float* trace,
+                                     const pmt::pmt_t& meta)
+{
+    message_port_pub(pmt::mp(port),
+                     pmt::cons(meta, pmt::init_f32vector(_acc.bins(), trace)));
+}
+
+void sweep_accumulator_impl::snapshot()
+{
+    pmt::pmt_t meta = _sweep.meta();
+    meta = pmt::dict_add(meta, pmt::mp("sweeps"), pmt::from_uint64(_acc.count()));
+    meta = pmt::dict_add(meta, pmt::mp("window_start_ns"), pmt::from_long(_window_start));
+
+    publish("max_hold", _acc.max_hold().data(), meta);
+    publish("min_hold", _acc.min_hold().data(), meta);
+    publish("average", _acc.average().data(), meta);
+
+    _occupancy.resize(_acc.bins());
+    _acc.occupancy(_occupancy.data());
+    publish("occupancy", _occupancy.data(), meta);
+}
+
+void sweep_accumulator_impl::handle_sweep(const pmt::pmt_t& msg)
+{
+    if (!_incoming.from_pdu(msg)) {
+        std::cout << "sweep_accumulator: ignoring a message that is not a sweep" << std::endl;
+        return;
+    }
+
+    gr::thread::scoped_lock lock(_mutex);
+
+    // A retune starts a new window
+    if (!_incoming.same_bins(_sweep) || _acc.bins() != _incoming.bins.size()) {
+        _acc.reset(_incoming.bins.size());
+    }
+    std::swap(_sweep, _incoming);
+
+    if (_acc.count() == 0) {
+        _window_start = _sweep.ns_since_epoch;
+    }
+    _acc.update(_sweep.bins.data());
+
+    clock::time_point now = clock::now();
+    if (_interval <= 0.0 ||
+        std::chrono::duration<double>(now - _last_snapshot).count() >= _interval) {
+        snapshot();
+        _last_snapshot = now;
+        if (_reset_on_snapshot) {
+            _acc.reset(_acc.bins());
+        }
+    }
+}
+
+} /* namespace signal_hound */
+} /* namespace gr */
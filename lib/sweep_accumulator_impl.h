@@ -0,0 +1,57 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SWEEP_ACCUMULATOR_IMPL_H
+#define INCLUDED_SIGNAL_HOUND_SWEEP_ACCUMULATOR_IMPL_H
+
+#include "sweep_pdu.h"
+#include "trace_accumulator.h"
+#include <gnuradio/signal_hound/sweep_accumulator.h>
+#include <chrono>
+
+namespace gr {
+namespace signal_hound {
+
+class sweep_accumulator_impl : public sweep_accumulator
+{
+private:
+    typedef std::chrono::steady_clock clock;
+
+    gr::thread::mutex _mutex;
+    trace_accumulator _acc;
+    double _interval;
+    bool _reset_on_snapshot;
+
+    sweep_trace _sweep, _incoming;
+    int64_t _window_start;
+    clock::time_point _last_snapshot;
+    std::vector<float> _occupancy;
+
+    void handle_sweep(const pmt::pmt_t& msg);
+    void publish(const char* port, const float* trace, const pmt::pmt_t& meta);
+    void snapshot(void);
+
+public:
+    sweep_accumulator_impl(const std::string& average,
+                           double alpha,
+                           double threshold,
+                           double interval,
+                           bool reset_on_snapshot);
+    ~sweep_accumulator_impl();
+
+    void set_average(const std::string& average, double alpha);
+    void set_threshold(double threshold);
+    void set_interval(double interval);
+    void set_reset_on_snapshot(bool reset_on_snapshot);
+    void reset();
+    uint64_t sweeps();
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SWEEP_ACCUMULATOR_IMPL_H */
@@ -0,0 +1,207 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "sweep_delta.h"
+#include <volk/volk.h>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+
+namespace gr {
+namespace signal_hound {
+namespace sweep_delta {
+
+// Bins checked at once when skipping over unchanged stretches
+static const size_t SKIP_BLOCK = 64;
+
+static void put_varint(std::vector<uint8_t>& out, uint32_t v)
+{
+    while (v >= 0x80) {
+        out.push_back((uint8_t)(v | 0x80));
+        v >>= 7;
+    }
+    out.push_back((uint8_t)v);
+}
+
+static bool get_varint(const uint8_t*& in, const uint8_t* end, uint32_t& v)
+{
+    v = 0;
+    for (int shift = 0; shift < 35 && in < end; shift += 7) {
+        uint8_t b = *in++;
+        v |= (uint32_t)(b & 0x7f) << shift;
+        if (!(b & 0x80)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//! True if any of \p n bins moved more than \p threshold, written to vectorize
+static bool any_changed(const int16_t* a, const int16_t* b, size_t n, int threshold)
+{
+    int changed = 0;
+    for (size_t k = 0; k < n; k++) {
+        changed |= std::abs((int)a[k] - (int)b[k]) > threshold;
+    }
+    return changed;
+}
+
+encoder::encoder(float threshold, int key_interval, float quantum)
+    : _quantum(quantum), _key_interval(key_interval), _since_key(0)
+{
+    if (quantum <= 0.0f) {
+        throw std::invalid_argument("sweep_delta: quantum must be positive");
+    }
+    set_threshold(threshold);
+    memset(&_header, 0, sizeof(_header));
+    _header.magic = MAGIC;
+    _header.version = VERSION;
+    _header.quantum = quantum;
+}
+
+void encoder::set_threshold(float threshold)
+{
+    _threshold = (int16_t)std::max(0.0f, std::min(32767.0f, std::round(threshold / _quantum)));
+}
+
+void encoder::put_key(std::vector<uint8_t>& out)
+{
+    out.resize(sizeof(frame_header) + _current.size() * sizeof(int16_t));
+    memcpy(&out[sizeof(frame_header)], _current.data(), _current.size() * sizeof(int16_t));
+    _key.swap(_current);
+    _header.key_sequence = _header.sequence;
+    _since_key = 0;
+}
+
+bool encoder::put_delta(std::vector<uint8_t>& out)
+{
+    // Give up as soon as the delta is no smaller than a key frame
+    const size_t limit = sizeof(frame_header) + _current.size() * sizeof(int16_t);
+    const int16_t* cur = _current.data();
+    const int16_t* key = _key.data();
+    const size_t n = _current.size();
+    const int threshold = _threshold;
+
+    size_t i = 0, last = 0;
+    while (i < n) {
+        if (i % SKIP_BLOCK == 0 && i + SKIP_BLOCK <= n &&
+            !any_changed(cur + i, key + i, SKIP_BLOCK, threshold)) {
+            i += SKIP_BLOCK;
+            continue;
+        }
+        if (std::abs((int)cur[i] - (int)key[i]) <= threshold) {
+            i++;
+            continue;
+        }
+
+        size_t first = i;
+        while (i < n && std::abs((int)cur[i] - (int)key[i]) > threshold) {
+            i++;
+        }
+        put_varint(out, first - last);
+        put_varint(out, i - first);
+        size_t at = out.size();
+        out.resize(at + (i - first) * sizeof(int16_t));
+        memcpy(&out[at], cur + first, (i - first) * sizeof(int16_t));
+        last = i;
+
+        if (out.size() >= limit) {
+            return false;
+        }
+    }
+    _since_key++;
+    return true;
+}
+
+bool encoder::encode(const sweep_trace& sweep, std::vector<uint8_t>& out)
+{
+    const size_t n = sweep.bins.size();
+    _current.resize(n);
+    volk_32f_s32f_convert_16i(_current.data(), sweep.bins.data(), 1.0f / _quantum, n);
+
+    bool key = _key.size() != n || _header.start_freq != sweep.start_freq ||
+               _header.bin_size != sweep.bin_size ||
+               (_key_interval > 0 && _since_key + 1 >= _key_interval);
+
+    _header.sequence++;
+    _header.bins = n;
+    _header.ns_since_epoch = sweep.ns_since_epoch;
+    _header.start_freq = sweep.start_freq;
+    _header.bin_size = sweep.bin_size;
+    _header.rbw = sweep.rbw;
+
+    out.clear();
+    out.resize(sizeof(frame_header));
+    if (key || !put_delta(out)) {
+        key = true;
+        put_key(out);
+    }
+
+    _header.type = key ? KEY_FRAME : DELTA_FRAME;
+    _header.payload_bytes = out.size() - sizeof(frame_header);
+    memcpy(&out[0], &_header, sizeof(frame_header));
+    return key;
+}
+
+decoder::decoder() : _have_key(false) { memset(&_key_header, 0, sizeof(_key_header)); }
+
+bool decoder::decode(const uint8_t* in, size_t len, sweep_trace& sweep)
+{
+    frame_header header;
+    if (len < sizeof(header)) {
+        return false;
+    }
+    memcpy(&header, in, sizeof(header));
+    if (header.magic != MAGIC || header.version != VERSION || header.quantum <= 0.0f ||
+        header.payload_bytes != len - sizeof(header)) {
+        return false;
+    }
+    const uint8_t* p = in + sizeof(header);
+    const uint8_t* end = in + len;
+    const size_t n = header.bins;
+
+    if (header.type == KEY_FRAME) {
+        if (header.payload_bytes != n * sizeof(int16_t)) {
+            return false;
+        }
+        _key.resize(n);
+        memcpy(_key.data(), p, n * sizeof(int16_t));
+        _key_header = header;
+        _have_key = true;
+    } else if (header.type != DELTA_FRAME || !_have_key ||
+               header.key_sequence != _key_header.sequence || n != _key.size()) {
+        return false;
+    }
+
+    sweep.start_freq = header.start_freq;
+    sweep.bin_size = header.bin_size;
+    sweep.rbw = header.rbw;
+    sweep.ns_since_epoch = header.ns_since_epoch;
+    sweep.bins.resize(n);
+    volk_16i_s32f_convert_32f(sweep.bins.data(), _key.data(), 1.0f / header.quantum, n);
+
+    size_t bin = 0;
+    while (header.type == DELTA_FRAME && p < end) {
+        uint32_t skip, count;
+        if (!get_varint(p, end, skip) || !get_varint(p, end, count) ||
+            bin + skip + count > n || (size_t)(end - p) < count * sizeof(int16_t)) {
+            return false;
+        }
+        bin += skip;
+        for (uint32_t k = 0; k < count; k++, bin++, p += sizeof(int16_t)) {
+            int16_t v;
+            memcpy(&v, p, sizeof(v));
+            sweep.bins[bin] = v * header.quantum;
+        }
+    }
+    return true;
+}
+
+} // namespace sweep_delta
+} // namespace signal_hound
+} // namespace gr
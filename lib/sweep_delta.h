@@ -0,0 +1,106 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_H
+#define INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_H
+
+#include "sweep_pdu.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+/*
+ * Delta coding of sweep traces for narrow links.
+ *
+ * Bins are quantized to int16 steps of a fixed number of dB. A key frame
+ * carries every bin. The delta frames that follow carry only the bins
+ * that moved more than the threshold away from the key frame, so each one
+ * can be decoded on its own given its key and a lost delta costs nothing
+ * more than that sweep. Bins a delta leaves out are shown at their key
+ * frame value, which is within the threshold of the truth. Key frames are
+ * sent every key_interval sweeps, when the sweep frequencies change, and
+ * whenever a delta would not be smaller.
+ *
+ * Frame layout: a frame_header, then for a key frame one int16 per bin,
+ * and for a delta frame a list of runs, each an unsigned LEB128 count of
+ * unchanged bins to skip, an LEB128 count of changed bins and that many
+ * int16 values. Fields are in host byte order.
+ */
+namespace sweep_delta {
+
+const uint32_t MAGIC = 0x44534853; // "SHSD"
+const uint8_t VERSION = 1;
+const uint8_t KEY_FRAME = 0;
+const uint8_t DELTA_FRAME = 1;
+
+struct frame_header {
+    uint32_t magic;
+    uint8_t version;
+    uint8_t type;
+    uint16_t reserved;
+    uint32_t sequence;     //!< Frame counter
+    uint32_t key_sequence; //!< Key frame this frame decodes against
+    uint32_t bins;
+    uint32_t payload_bytes;
+    int64_t ns_since_epoch;
+    double start_freq;
+    double bin_size;
+    double rbw;
+    float quantum; //!< dB per step
+    uint32_t reserved2;
+};
+
+class encoder
+{
+public:
+    encoder(float threshold = 0.5f, int key_interval = 100, float quantum = 0.01f);
+
+    void set_threshold(float threshold);
+    void set_key_interval(int key_interval) { _key_interval = key_interval; }
+
+    //! Encode \p sweep into \p out, returns true for a key frame
+    bool encode(const sweep_trace& sweep, std::vector<uint8_t>& out);
+
+private:
+    void put_key(std::vector<uint8_t>& out);
+    bool put_delta(std::vector<uint8_t>& out);
+
+    float _quantum;
+    int16_t _threshold;
+    int _key_interval;
+
+    frame_header _header;
+    int _since_key;
+    std::vector<int16_t> _key;
+    std::vector<int16_t> _current;
+};
+
+class decoder
+{
+public:
+    decoder();
+
+    /*!
+     * Decode \p len bytes into \p sweep. Returns false if the frame is
+     * corrupt or its key frame was never received.
+     */
+    bool decode(const uint8_t* in, size_t len, sweep_trace& sweep);
+
+private:
+    bool _have_key;
+    frame_header _key_header;
+    std::vector<int16_t> _key;
+};
+
+} // namespace sweep_delta
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_H */
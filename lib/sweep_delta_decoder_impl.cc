@@ -0,0 +1,72 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "sweep_delta_decoder_impl.h"
+#include <gnuradio/io_signature.h>
+
+namespace gr {
+namespace signal_hound {
+
+sweep_delta_decoder::sptr sweep_delta_decoder::make()
+{
+    return gnuradio::make_block_sptr<sweep_delta_decoder_impl>();
+}
+
+
+/*
+ * The private constructor
+ */
+sweep_delta_decoder_impl::sweep_delta_decoder_impl()
+    : gr::block("sweep_delta_decoder",
+                gr::io_signature::make(0, 0, 0),
+                gr::io_signature::make(0, 0, 0)),
+      _frames(0),
+      _dropped(0)
+{
+    message_port_register_in(pmt::mp("encoded"));
+    set_msg_handler(pmt::mp("encoded"), [this](const pmt::pmt_t& msg) { handle_frame(msg); });
+
+    message_port_register_out(pmt::mp("sweeps"));
+}
+
+/*
+ * Our virtual destructor.
+ */
+sweep_delta_decoder_impl::~sweep_delta_decoder_impl() {}
+
+uint64_t sweep_delta_decoder_impl::frames() { return _frames; }
+
+uint64_t sweep_delta_decoder_impl::dropped() { return _dropped; }
+
+bool sweep_delta_decoder_impl::start()
+{
+    _frames = 0;
+    _dropped = 0;
+    return sweep_delta_decoder::start();
+}
+
+void sweep_delta_decoder_impl::handle_frame(const pmt::pmt_t& msg)
+{
+    // Take a PDU or the bare bytes
+    pmt::pmt_t bytes = pmt::is_pair(msg) ? pmt::cdr(msg) : msg;
+    if (!pmt::is_u8vector(bytes)) {
+        _dropped++;
+        return;
+    }
+
+    size_t len = 0;
+    const uint8_t* frame = pmt::u8vector_elements(bytes, len);
+    if (!_decoder.decode(frame, len, _sweep)) {
+        _dropped++;
+        return;
+    }
+    _frames++;
+    message_port_pub(pmt::mp("sweeps"), _sweep.to_pdu());
+}
+
+} /* namespace signal_hound */
+} /* namespace gr */
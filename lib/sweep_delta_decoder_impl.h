@@ -0,0 +1,41 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_DECODER_IMPL_H
+#define INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_DECODER_IMPL_H
+
+#include "sweep_delta.h"
+#include <gnuradio/signal_hound/sweep_delta_decoder.h>
+#include <atomic>
+
+namespace gr {
+namespace signal_hound {
+
+class sweep_delta_decoder_impl : public sweep_delta_decoder
+{
+private:
+    sweep_delta::decoder _decoder;
+    sweep_trace _sweep;
+    std::atomic<uint64_t> _frames;
+    std::atomic<uint64_t> _dropped;
+
+    void handle_frame(const pmt::pmt_t& msg);
+
+public:
+    sweep_delta_decoder_impl();
+    ~sweep_delta_decoder_impl();
+
+    uint64_t frames();
+    uint64_t dropped();
+
+    bool start(void);
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_DECODER_IMPL_H */
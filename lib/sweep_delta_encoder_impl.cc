@@ -0,0 +1,113 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "sweep_delta_encoder_impl.h"
+#include <gnuradio/io_signature.h>
+
+namespace gr {
+namespace signal_hound {
+
+sweep_delta_encoder::sptr
+sweep_delta_encoder::make(double threshold, int key_interval, double quantum)
+{
+    return gnuradio::make_block_sptr<sweep_delta_encoder_impl>(
+        threshold, key_interval, quantum);
+}
+
+
+/*
+ * The private constructor
+ */
+sweep_delta_encoder_impl::sweep_delta_encoder_impl(double threshold,
+                                                   int key_interval,
+                                                   double quantum)
+    : gr::block("sweep_delta_encoder",
+                gr::io_signature::make(0, 0, 0),
+                gr::io_signature::make(0, 0, 0)),
+      _encoder(threshold, key_interval, quantum),
+      _bytes_in(0),
+      _bytes_out(0),
+      _frames(0),
+      _key_frames(0)
+{
+    message_port_register_in(pmt::mp("sweeps"));
+    set_msg_handler(pmt::mp("sweeps"), [this](const pmt::pmt_t& msg) { handle_sweep(msg); });
+
+    message_port_register_out(pmt::mp("encoded"));
+}
+
+/*
+ * Our virtual destructor.
+ */
+sweep_delta_encoder_impl::~sweep_delta_encoder_impl() {}
+
+void sweep_delta_encoder_impl::set_threshold(double threshold)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _encoder.set_threshold(threshold);
+}
+
+void sweep_delta_encoder_impl::set_key_interval(int key_interval)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _encoder.set_key_interval(key_interval);
+}
+
+double sweep_delta_encoder_impl::compression_ratio()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _bytes_out ? (double)_bytes_in / _bytes_out : 0.0;
+}
+
+uint64_t sweep_delta_encoder_impl::frames()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _frames;
+}
+
+uint64_t sweep_delta_encoder_impl::key_frames()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _key_frames;
+}
+
+bool sweep_delta_encoder_impl::start()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _bytes_in = 0;
+    _bytes_out = 0;
+    _frames = 0;
+    _key_frames = 0;
+    return sweep_delta_encoder::start();
+}
+
+void sweep_delta_encoder_impl::handle_sweep(const pmt::pmt_t& msg)
+{
+    if (!_sweep.from_pdu(msg)) {
+        std::cout << "sweep_delta_encoder: ignoring a message that is not a sweep"
+                  << std::endl;
+        return;
+    }
+
+    bool key;
+    {
+        gr::thread::scoped_lock lock(_mutex);
+        key = _encoder.encode(_sweep, _frame);
+        _bytes_in += _sweep.bins.size() * sizeof(float);
+        _bytes_out += _frame.size();
+        _frames++;
+        _key_frames += key;
+    }
+
+    pmt::pmt_t meta = pmt::make_dict();
+    meta = pmt::dict_add(meta, pmt::mp("key"), pmt::from_bool(key));
+    message_port_pub(pmt::mp("encoded"),
+                     pmt::cons(meta, pmt::init_u8vector(_frame.size(), _frame.data())));
+}
+
+} /* namespace signal_hound */
+} /* namespace gr */
@@ -0,0 +1,48 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_ENCODER_IMPL_H
+#define INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_ENCODER_IMPL_H
+
+#include "sweep_delta.h"
+#include <gnuradio/signal_hound/sweep_delta_encoder.h>
+
+namespace gr {
+namespace signal_hound {
+
+class sweep_delta_encoder_impl : public sweep_delta_encoder
+{
+private:
+    gr::thread::mutex _mutex;
+    sweep_delta::encoder _encoder;
+
+    sweep_trace _sweep;
+    std::vector<uint8_t> _frame;
+    uint64_t _bytes_in;
+    uint64_t _bytes_out;
+    uint64_t _frames;
+    uint64_t _key_frames;
+
+    void handle_sweep(const pmt::pmt_t& msg);
+
+public:
+    sweep_delta_encoder_impl(double threshold, int key_interval, double quantum);
+    ~sweep_delta_encoder_impl();
+
+    void set_threshold(double threshold);
+    void set_key_interval(int key_interval);
+    double compression_ratio();
+    uint64_t frames();
+    uint64_t key_frames();
+
+    bool start(void);
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SWEEP_DELTA_ENCODER_IMPL_H */
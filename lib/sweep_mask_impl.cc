@@ -0,0 +1,140 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "sweep_mask_impl.h"
+#include <gnuradio/io_signature.h>
+
+namespace gr {
+namespace signal_hound {
+
+sweep_mask::sptr sweep_mask::make(
+    double threshold, double hysteresis, double floor, double excursion, int max_peaks)
+{
+    return gnuradio::make_block_sptr<sweep_mask_impl>(
+        threshold, hysteresis, floor, excursion, max_peaks);
+}
+
+
+/*
+ * The private constructor
+ */
+sweep_mask_impl::sweep_mask_impl(
+    double threshold, double hysteresis, double floor, double excursion, int max_peaks)
+    : gr::block("sweep_mask", gr::io_signature::make(0, 0, 0), gr::io_signature::make(0, 0, 0)),
+      _mask(threshold),
+      _compare(hysteresis, floor, excursion),
+      _max_peaks(max_peaks),
+      _sweeps(0),
+      _violating(0)
+{
+    message_port_register_in(pmt::mp("sweeps"));
+    set_msg_handler(pmt::mp("sweeps"), [this](const pmt::pmt_t& msg) { handle_sweep(msg); });
+
+    message_port_register_out(pmt::mp("violations"));
+    message_port_register_out(pmt::mp("peaks"));
+}
+
+/*
+ * Our virtual destructor.
+ */
+sweep_mask_impl::~sweep_mask_impl() {}
+
+void sweep_mask_impl::set_threshold(double threshold)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _mask.set_threshold(threshold);
+}
+
+void sweep_mask_impl::set_mask(const std::vector<double>& freqs,
+                               const std::vector<double>& levels)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _mask.set_points(freqs, levels);
+}
+
+void sweep_mask_impl::set_hysteresis(double hysteresis)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _compare.set_hysteresis(hysteresis);
+}
+
+void sweep_mask_impl::set_peaks(double floor, double excursion, int max_peaks)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _compare.set_peaks(floor, excursion);
+    _max_peaks = max_peaks;
+}
+
+uint64_t sweep_mask_impl::sweeps()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _sweeps;
+}
+
+uint64_t sweep_mask_impl::violating_sweeps()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _violating;
+}
+
+bool sweep_mask_impl::start()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _sweeps = 0;
+    _violating = 0;
+    return sweep_mask::start();
+}
+
+void sweep_mask_impl::publish(const char* port, size_t count)
+{
+    pmt::pmt_t meta = _sweep.meta();
+    meta = pmt::dict_add(meta, pmt::mp("count"), pmt::from_uint64(count));
+    message_port_pub(pmt::mp(port),
+                     pmt::cons(meta, pmt::init_f64vector(_records.size(), _records.data())));
+}
+
+void sweep_mask_impl::handle_sweep(const pmt::pmt_t& msg)
+{
+    if (!_sweep.from_pdu(msg)) {
+        std::cout << "sweep_mask: ignoring a message that is not a sweep" << std::endl;
+        return;
+    }
+
+    gr::thread::scoped_lock lock(_mutex);
+    const float* trace = _sweep.bins.data();
+    const float* limit = _mask.line(_sweep);
+    _compare.process(trace, limit, _sweep.bins.size());
+    _sweeps++;
+
+    const std::vector<mask_run>& violations = _compare.violations();
+    if (!violations.empty()) {
+        _violating++;
+        _records.clear();
+        for (const mask_run& run : violations) {
+            _records.push_back(_sweep.freq(run.first));
+            _records.push_back(_sweep.freq(run.last));
+            _records.push_back(_sweep.freq(run.peak));
+            _records.push_back(trace[run.peak]);
+            _records.push_back(run.excess);
+        }
+        publish("violations", violations.size());
+    }
+
+    if (_max_peaks > 0) {
+        const std::vector<size_t>& peaks = _compare.peaks(trace, _max_peaks);
+        _records.clear();
+        for (size_t bin : peaks) {
+            _records.push_back(_sweep.freq(bin));
+            _records.push_back(trace[bin]);
+            _records.push_back(trace[bin] - limit[bin]);
+        }
+        publish("peaks", peaks.size());
+    }
+}
+
+} /* namespace signal_hound */
+} /* namespace gr */
@@ -0,0 +1,55 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SWEEP_MASK_IMPL_H
+#define INCLUDED_SIGNAL_HOUND_SWEEP_MASK_IMPL_H
+
+#include "limit_mask.h"
+#include "sweep_pdu.h"
+#include <gnuradio/signal_hound/sweep_mask.h>
+
+namespace gr {
+namespace signal_hound {
+
+class sweep_mask_impl : public sweep_mask
+{
+private:
+    gr::thread::mutex _mutex;
+    limit_mask _mask;
+    mask_compare _compare;
+    int _max_peaks;
+
+    sweep_trace _sweep;
+    std::vector<double> _records;
+    uint64_t _sweeps;
+    uint64_t _violating;
+
+    void handle_sweep(const pmt::pmt_t& msg);
+    void publish(const char* port, size_t count);
+
+public:
+    sweep_mask_impl(double threshold,
+                    double hysteresis,
+                    double floor,
+                    double excursion,
+                    int max_peaks);
+    ~sweep_mask_impl();
+
+    void set_threshold(double threshold);
+    void set_mask(const std::vector<double>& freqs, const std::vector<double>& levels);
+    void set_hysteresis(double hysteresis);
+    void set_peaks(double floor, double excursion, int max_peaks);
+    uint64_t sweeps();
+    uint64_t violating_sweeps();
+
+    bool start(void);
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SWEEP_MASK_IMPL_H */
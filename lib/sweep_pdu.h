@@ -0,0 +1,83 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_SWEEP_PDU_H
+#define INCLUDED_SIGNAL_HOUND_SWEEP_PDU_H
+
+#include <pmt/pmt.h>
+#include <cstdint>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief One swept trace, as carried between the sweep blocks.
+ *
+ * On the wire a sweep is a PDU whose metadata holds "start_freq" and
+ * "bin_size" in Hz, "rbw" in Hz and "ns_since_epoch", and whose vector is
+ * the float32 trace in dBm, one value per bin.
+ */
+struct sweep_trace {
+    double start_freq;
+    double bin_size;
+    double rbw;
+    int64_t ns_since_epoch;
+    std::vector<float> bins;
+
+    sweep_trace() : start_freq(0.0), bin_size(0.0), rbw(0.0), ns_since_epoch(0) {}
+
+    double freq(size_t bin) const { return start_freq + bin * bin_size; }
+
+    //! Metadata describing the trace, for PDUs that add their own keys
+    pmt::pmt_t meta() const
+    {
+        pmt::pmt_t meta = pmt::make_dict();
+        meta = pmt::dict_add(meta, pmt::mp("start_freq"), pmt::from_double(start_freq));
+        meta = pmt::dict_add(meta, pmt::mp("bin_size"), pmt::from_double(bin_size));
+        meta = pmt::dict_add(meta, pmt::mp("rbw"), pmt::from_double(rbw));
+        meta = pmt::dict_add(meta, pmt::mp("ns_since_epoch"), pmt::from_long(ns_since_epoch));
+        return meta;
+    }
+
+    pmt::pmt_t to_pdu() const
+    {
+        return pmt::cons(meta(), pmt::init_f32vector(bins.size(), bins.data()));
+    }
+
+    //! True if \p other covers the same bins
+    bool same_bins(const sweep_trace& other) const
+    {
+        return start_freq == other.start_freq && bin_size == other.bin_size &&
+               bins.size() == other.bins.size();
+    }
+
+    //! Fill from a sweep PDU, false if \p pdu is not one
+    bool from_pdu(const pmt::pmt_t& pdu)
+    {
+        if (!pmt::is_pair(pdu) || !pmt::is_f32vector(pmt::cdr(pdu))) {
+            return false;
+        }
+        pmt::pmt_t meta = pmt::car(pdu);
+        start_freq = pmt::to_double(
+            pmt::dict_ref(meta, pmt::mp("start_freq"), pmt::from_double(0.0)));
+        bin_size =
+            pmt::to_double(pmt::dict_ref(meta, pmt::mp("bin_size"), pmt::from_double(0.0)));
+        rbw = pmt::to_double(pmt::dict_ref(meta, pmt::mp("rbw"), pmt::from_double(0.0)));
+        ns_since_epoch =
+            pmt::to_long(pmt::dict_ref(meta, pmt::mp("ns_since_epoch"), pmt::from_long(0)));
+        size_t len = 0;
+        const float* trace = pmt::f32vector_elements(pmt::cdr(pdu), len);
+        bins.assign(trace, trace + len);
+        return bin_size > 0.0;
+    }
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_SWEEP_PDU_H */
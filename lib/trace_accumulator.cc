@@ -0,0 +1,98 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "trace_accumulator.h"
+#include <volk/volk.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace gr {
+namespace signal_hound {
+
+// Bins processed by every kernel before moving on, 4 kB of floats
+static const size_t TILE = 1024;
+
+trace_accumulator::trace_accumulator(average_mode mode, float alpha, float threshold)
+    : _threshold(threshold), _count(0), _occupancy_count(0)
+{
+    set_average(mode, alpha);
+    _scratch.resize(TILE);
+}
+
+void trace_accumulator::set_average(average_mode mode, float alpha)
+{
+    if (mode == AVERAGE_EXPONENTIAL && (alpha <= 0.0f || alpha > 1.0f)) {
+        throw std::invalid_argument("trace_accumulator: alpha must be in (0, 1]");
+    }
+    _mode = mode;
+    _alpha = alpha;
+}
+
+void trace_accumulator::set_threshold(float threshold)
+{
+    _threshold = threshold;
+    std::fill(_above.begin(), _above.end(), 0);
+    _occupancy_count = 0;
+}
+
+void trace_accumulator::reset(size_t bins)
+{
+    _max.assign(bins, 0.0f);
+    _min.assign(bins, 0.0f);
+    _avg.assign(bins, 0.0f);
+    _above.assign(bins, 0);
+    _count = 0;
+    _occupancy_count = 0;
+}
+
+void trace_accumulator::update(const float* trace)
+{
+    const size_t n = _max.size();
+    _count++;
+    _occupancy_count++;
+
+    if (_count == 1) {
+        memcpy(_max.data(), trace, n * sizeof(float));
+        memcpy(_min.data(), trace, n * sizeof(float));
+        memcpy(_avg.data(), trace, n * sizeof(float));
+    }
+    const float alpha = _mode == AVERAGE_LINEAR ? 1.0f / _count : _alpha;
+
+    float* scratch = _scratch.data();
+    for (size_t i = 0; i < n; i += TILE) {
+        const unsigned int len = std::min(TILE, n - i);
+        const float* x = trace + i;
+        float* avg = &_avg[i];
+
+        volk_32f_x2_max_32f(&_max[i], &_max[i], x, len);
+        volk_32f_x2_min_32f(&_min[i], &_min[i], x, len);
+
+        // avg += alpha * (x - avg)
+        volk_32f_x2_subtract_32f(scratch, x, avg, len);
+        volk_32f_s32f_multiply_32f(scratch, scratch, alpha, len);
+        volk_32f_x2_add_32f(avg, avg, scratch, len);
+
+        // Branch free so the compiler vectorizes it
+        uint32_t* above = &_above[i];
+        const float threshold = _threshold;
+        for (unsigned int k = 0; k < len; k++) {
+            above[k] += x[k] > threshold;
+        }
+    }
+}
+
+void trace_accumulator::occupancy(float* out) const
+{
+    const float scale = _occupancy_count ? 1.0f / _occupancy_count : 0.0f;
+    for (size_t i = 0; i < _above.size(); i++) {
+        out[i] = _above[i] * scale;
+    }
+}
+
+} // namespace signal_hound
+} // namespace gr
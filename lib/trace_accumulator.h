@@ -0,0 +1,75 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_TRACE_ACCUMULATOR_H
+#define INCLUDED_SIGNAL_HOUND_TRACE_ACCUMULATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+/*
+ * Running statistics over a sequence of equally sized traces in dBm.
+ *
+ * Each update() walks the new trace once, in tiles small enough to stay in
+ * L1, running the max-hold, min-hold, average and occupancy kernels over a
+ * tile before moving to the next. Memory is set by the trace length alone,
+ * however many traces have been folded in.
+ *
+ * The linear average is the running mean, kept as an exponential average
+ * whose weight is 1/n so it does not lose precision as n grows. Occupancy
+ * counts the traces in which each bin was above the threshold.
+ */
+class trace_accumulator
+{
+public:
+    enum average_mode { AVERAGE_LINEAR, AVERAGE_EXPONENTIAL };
+
+    trace_accumulator(average_mode mode = AVERAGE_LINEAR,
+                      float alpha = 0.1f,
+                      float threshold = -80.0f);
+
+    //! \p alpha weights the newest trace in exponential mode
+    void set_average(average_mode mode, float alpha);
+
+    //! Changing the threshold restarts the occupancy counts
+    void set_threshold(float threshold);
+
+    //! Forget all traces and expect \p bins per trace from now on
+    void reset(size_t bins);
+
+    void update(const float* trace);
+
+    size_t bins() const { return _max.size(); }
+    uint64_t count() const { return _count; }
+
+    const std::vector<float>& max_hold() const { return _max; }
+    const std::vector<float>& min_hold() const { return _min; }
+    const std::vector<float>& average() const { return _avg; }
+
+    //! Fraction of traces each bin was above the threshold, into \p out
+    void occupancy(float* out) const;
+
+private:
+    average_mode _mode;
+    float _alpha;
+    float _threshold;
+
+    std::vector<float> _max, _min, _avg;
+    std::vector<uint32_t> _above;
+    std::vector<float> _scratch;
+    uint64_t _count;
+    uint64_t _occupancy_count;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_TRACE_ACCUMULATOR_H */
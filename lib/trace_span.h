@@ -0,0 +1,73 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_TRACE_SPAN_H
+#define INCLUDED_SIGNAL_HOUND_TRACE_SPAN_H
+
+#include <atomic>
+#include <cstdint>
+#include <time.h>
+
+namespace gr {
+namespace signal_hound {
+namespace tracing {
+
+// Set by enable(), read on every span
+extern std::atomic<bool> active;
+
+inline int64_t now_ns()
+{
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+//! Append a span to the calling thread's buffer, names must be literals
+void record(const char* category, const char* name, int64_t begin, int64_t end);
+
+/*
+ * Records the enclosing scope as a span. Disabled, a span costs one
+ * relaxed load; enabled, two clock reads and a buffer write.
+ */
+class span
+{
+public:
+    span(const char* category, const char* name)
+        : _category(category),
+          _name(name),
+          _begin(active.load(std::memory_order_relaxed) ? now_ns() : 0)
+    {
+    }
+
+    ~span()
+    {
+        if (_begin) {
+            record(_category, _name, _begin, now_ns());
+        }
+    }
+
+    span(const span&) = delete;
+    span& operator=(const span&) = delete;
+
+private:
+    const char* _category;
+    const char* _name;
+    int64_t _begin;
+};
+
+} // namespace tracing
+} // namespace signal_hound
+} // namespace gr
+
+#define SH_TRACE_CONCAT2(a, b) a##b
+#define SH_TRACE_CONCAT(a, b) SH_TRACE_CONCAT2(a, b)
+
+//! Trace the rest of the enclosing scope
+#define SH_TRACE(category, name) \
+    ::gr::signal_hound::tracing::span SH_TRACE_CONCAT(_trace_span_, __LINE__)(category, name)
+
+#endif /* INCLUDED_SIGNAL_HOUND_TRACE_SPAN_H */
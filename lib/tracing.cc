@@ -0,0 +1,272 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "trace_span.h"
+#include <gnuradio/signal_hound/tracing.h>
+#include <pthread.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+namespace tracing {
+
+// Spans kept per thread, a power of two
+static const uint64_t CAPACITY = 1 << 16;
+
+std::atomic<bool> active(false);
+
+namespace {
+
+struct event {
+    const char* category;
+    const char* name;
+    int64_t begin;
+    int64_t end;
+};
+
+/*
+ * Written only by its own thread. The slot of each event is claimed before
+ * it is overwritten and the count is published with release ordering after,
+ * so a dump sees whole events up to the count. A dump copies without
+ * stopping the writer, then drops the slots claimed again meanwhile, which
+ * can only be the oldest events of a full buffer. The thread marks it dead
+ * on exit, after which the next clear() or dump() frees it.
+ */
+struct thread_buffer {
+    long tid;
+    std::string name;
+    std::vector<event> events;
+    std::atomic<uint64_t> claimed;
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> cleared;
+    std::atomic<bool> dead;
+
+    thread_buffer()
+        : tid(0), events(CAPACITY), claimed(0), count(0), cleared(0), dead(false)
+    {
+    }
+};
+
+// Buffers outlive their threads until dumped once, so the spans of a
+// finished thread are not lost
+struct registry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<thread_buffer>> buffers;
+};
+
+registry& buffers()
+{
+    static registry r;
+    return r;
+}
+
+// Marks the buffer of an exiting thread dead
+struct thread_owner {
+    thread_buffer* buffer = nullptr;
+
+    ~thread_owner()
+    {
+        if (buffer) {
+            buffer->dead.store(true, std::memory_order_release);
+        }
+    }
+};
+
+thread_local thread_owner local;
+
+// A thread's spans as dumped
+struct thread_events {
+    long tid;
+    std::string name;
+    std::vector<event> events;
+};
+
+thread_buffer* register_thread()
+{
+    auto buffer = std::make_shared<thread_buffer>();
+    buffer->tid = syscall(SYS_gettid);
+    // The scheduler names its threads after their blocks
+    char name[64] = "";
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+    buffer->name = name[0] ? name : "thread " + std::to_string(buffer->tid);
+
+    registry& r = buffers();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    r.buffers.push_back(buffer);
+    return buffer.get();
+}
+
+void write_string(FILE* f, const char* s)
+{
+    fputc('"', f);
+    for (; *s; s++) {
+        if (*s == '"' || *s == '\\') {
+            fputc('\\', f);
+        }
+        if ((unsigned char)*s >= 0x20) {
+            fputc(*s, f);
+        }
+    }
+    fputc('"', f);
+}
+
+// Enabled from the environment at load, dumped at exit
+struct environment {
+    std::string path;
+
+    environment()
+    {
+        const char* env = getenv("GR_SIGNAL_HOUND_TRACE");
+        if (env && *env) {
+            path = env;
+            enable(true);
+        }
+    }
+
+    ~environment()
+    {
+        if (path.empty()) {
+            return;
+        }
+        try {
+            dump(path);
+        } catch (const std::exception& e) {
+            std::cerr << e.what() << std::endl;
+        }
+    }
+};
+
+// Constructed after, so destroyed before, the registry it dumps
+const registry& registry_first = buffers();
+environment from_environment;
+
+} // namespace
+
+void record(const char* category, const char* name, int64_t begin, int64_t end)
+{
+    thread_buffer* b = local.buffer;
+    if (!b) {
+        b = local.buffer = register_thread();
+    }
+    uint64_t n = b->count.load(std::memory_order_relaxed);
+    b->claimed.store(n + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    b->events[n & (CAPACITY - 1)] = { category, name, begin, end };
+    b->count.store(n + 1, std::memory_order_release);
+}
+
+void enable(bool on) { active.store(on, std::memory_order_relaxed); }
+
+bool enabled() { return active.load(std::memory_order_relaxed); }
+
+void clear()
+{
+    registry& r = buffers();
+    std::lock_guard<std::mutex> lock(r.mutex);
+    for (auto& b : r.buffers) {
+        b->cleared.store(b->count.load(std::memory_order_acquire), std::memory_order_relaxed);
+    }
+    r.buffers.erase(std::remove_if(r.buffers.begin(),
+                                   r.buffers.end(),
+                                   [](const std::shared_ptr<thread_buffer>& b) {
+                                       return b->dead.load(std::memory_order_acquire);
+                                   }),
+                    r.buffers.end());
+}
+
+void dump(const std::string& path)
+{
+    // Copy under the lock, write after it, so threads starting meanwhile
+    // are not held up by the file
+    std::vector<thread_events> threads;
+    {
+        registry& r = buffers();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (auto& b : r.buffers) {
+            // Seen dead, the thread has recorded its last span
+            bool dead = b->dead.load(std::memory_order_acquire);
+            uint64_t end = b->count.load(std::memory_order_acquire);
+            uint64_t begin = std::max(b->cleared.load(std::memory_order_relaxed),
+                                      end > CAPACITY ? end - CAPACITY : 0);
+            threads.push_back({ b->tid, b->name, {} });
+            std::vector<event>& events = threads.back().events;
+            for (uint64_t i = begin; i < end; i++) {
+                events.push_back(b->events[i & (CAPACITY - 1)]);
+            }
+
+            // Drop what the thread overwrote during the copy, claimed covers
+            // any event whose write the copy may have caught
+            std::atomic_thread_fence(std::memory_order_acquire);
+            uint64_t claimed = b->claimed.load(std::memory_order_relaxed);
+            if (claimed > begin + CAPACITY) {
+                uint64_t torn = std::min(end, claimed - CAPACITY) - begin;
+                events.erase(events.begin(), events.begin() + torn);
+            }
+
+            if (dead) {
+                b.reset();
+            }
+        }
+        r.buffers.erase(std::remove(r.buffers.begin(), r.buffers.end(), nullptr),
+                        r.buffers.end());
+    }
+
+    FILE* f = fopen(path.c_str(), "w");
+    if (!f) {
+        throw std::runtime_error("tracing: cannot create " + path + ": " + strerror(errno));
+    }
+
+    const long pid = getpid();
+    fprintf(f, "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n");
+    fprintf(f,
+            "{\"ph\":\"M\",\"name\":\"process_name\",\"pid\":%ld,\"args\":{\"name\":"
+            "\"gr-signal_hound\"}}",
+            pid);
+
+    for (const thread_events& t : threads) {
+        fprintf(f,
+                ",\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":%ld,\"tid\":%ld,"
+                "\"args\":{\"name\":",
+                pid,
+                t.tid);
+        write_string(f, t.name.c_str());
+        fprintf(f, "}}");
+
+        for (const event& e : t.events) {
+            fprintf(f, ",\n{\"ph\":\"X\",\"name\":");
+            write_string(f, e.name);
+            fprintf(f, ",\"cat\":");
+            write_string(f, e.category);
+            fprintf(f,
+                    ",\"pid\":%ld,\"tid\":%ld,\"ts\":%.3f,\"dur\":%.3f}",
+                    pid,
+                    t.tid,
+                    e.begin * 1e-3,
+                    (e.end - e.begin) * 1e-3);
+        }
+    }
+    fprintf(f, "\n]}\n");
+
+    if (fclose(f) != 0) {
+        throw std::runtime_error("tracing: cannot write " + path + ": " + strerror(errno));
+    }
+}
+
+} // namespace tracing
+} // namespace signal_hound
+} // namespace gr
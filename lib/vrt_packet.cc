@@ -0,0 +1,181 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "vrt_packet.h"
+#include <arpa/inet.h>
+#include <cmath>
+#include <cstring>
+
+namespace gr {
+namespace signal_hound {
+namespace vrt {
+
+static const uint32_t TSI_UTC = 0x1;
+static const uint32_t TSF_REAL_TIME = 0x2;
+
+static inline uint32_t header_word(uint32_t type, uint32_t count, size_t words)
+{
+    return (type << 28) | (TSI_UTC << 22) | (TSF_REAL_TIME << 20) | ((count & 0xf) << 16) |
+           (uint32_t)(words & 0xffff);
+}
+
+static size_t pack_prefix(uint32_t* words,
+                          uint32_t type,
+                          uint32_t stream_id,
+                          uint32_t count,
+                          int64_t ns_since_epoch,
+                          size_t total_words)
+{
+    uint64_t ps = (uint64_t)(ns_since_epoch % 1000000000) * 1000;
+    words[0] = htonl(header_word(type, count, total_words));
+    words[1] = htonl(stream_id);
+    words[2] = htonl((uint32_t)(ns_since_epoch / 1000000000));
+    words[3] = htonl((uint32_t)(ps >> 32));
+    words[4] = htonl((uint32_t)ps);
+    return PREFIX_WORDS;
+}
+
+// 64-bit two's complement fixed point with a 20 bit radix
+static size_t pack_fixed20(uint32_t* words, double value)
+{
+    int64_t fixed = (int64_t)std::llround(value * (double)(1 << 20));
+    words[0] = htonl((uint32_t)((uint64_t)fixed >> 32));
+    words[1] = htonl((uint32_t)fixed);
+    return 2;
+}
+
+static double unpack_fixed20(const uint32_t* words)
+{
+    uint64_t raw = ((uint64_t)ntohl(words[0]) << 32) | ntohl(words[1]);
+    return (double)(int64_t)raw / (double)(1 << 20);
+}
+
+size_t pack_data(uint32_t* words,
+                 uint32_t stream_id,
+                 uint32_t count,
+                 int64_t ns_since_epoch,
+                 const gr_complex* iq,
+                 size_t samples)
+{
+    size_t total = data_packet_words(samples);
+    uint32_t* payload = words + pack_prefix(words, PACKET_IF_DATA, stream_id, count,
+                                            ns_since_epoch, total);
+
+    const uint32_t* raw = reinterpret_cast<const uint32_t*>(iq);
+    for (size_t i = 0; i < 2 * samples; i++) {
+        payload[i] = htonl(raw[i]);
+    }
+    return total;
+}
+
+size_t pack_context(uint32_t* words,
+                    uint32_t stream_id,
+                    uint32_t count,
+                    const stream_info& info,
+                    bool changed)
+{
+    uint32_t* p = words + pack_prefix(words, PACKET_CONTEXT, stream_id, count,
+                                      info.ns_since_epoch, CONTEXT_WORDS);
+
+    uint32_t cif0 =
+        CIF0_BANDWIDTH | CIF0_RF_REF_FREQ | CIF0_REF_LEVEL | CIF0_SAMPLE_RATE;
+    if (changed) {
+        cif0 |= CIF0_CHANGE;
+    }
+    *p++ = htonl(cif0);
+
+    // Fields follow in descending CIF0 bit order
+    p += pack_fixed20(p, info.bandwidth);
+    p += pack_fixed20(p, info.center);
+    int16_t level = (int16_t)std::lround(info.reflevel * 128.0);
+    *p++ = htonl((uint32_t)(uint16_t)level);
+    p += pack_fixed20(p, info.sample_rate);
+
+    return CONTEXT_WORDS;
+}
+
+bool parse(const uint32_t* words, size_t len_words, packet& pkt)
+{
+    if (len_words < PREFIX_WORDS) {
+        return false;
+    }
+
+    uint32_t header = ntohl(words[0]);
+    size_t size = header & 0xffff;
+    if (size < PREFIX_WORDS || size > len_words) {
+        return false;
+    }
+    // Only the layout produced by pack_data()/pack_context() is understood
+    if (((header >> 22) & 0x3) != TSI_UTC || ((header >> 20) & 0x3) != TSF_REAL_TIME ||
+        ((header >> 27) & 0x1)) {
+        return false;
+    }
+
+    pkt.type = header >> 28;
+    pkt.count = (header >> 16) & 0xf;
+    pkt.stream_id = ntohl(words[1]);
+    pkt.seconds = ntohl(words[2]);
+    pkt.picoseconds = ((uint64_t)ntohl(words[3]) << 32) | ntohl(words[4]);
+    pkt.payload = words + PREFIX_WORDS;
+    pkt.payload_words = size - PREFIX_WORDS;
+
+    // Drop the trailer word if the sender included one
+    if (pkt.type == PACKET_IF_DATA && ((header >> 26) & 0x1) && pkt.payload_words > 0) {
+        pkt.payload_words--;
+    }
+    return pkt.type == PACKET_IF_DATA || pkt.type == PACKET_CONTEXT;
+}
+
+void unpack_data(const packet& pkt, gr_complex* iq)
+{
+    uint32_t* raw = reinterpret_cast<uint32_t*>(iq);
+    size_t words = pkt.payload_words & ~(size_t)1;
+    for (size_t i = 0; i < words; i++) {
+        raw[i] = ntohl(pkt.payload[i]);
+    }
+}
+
+bool unpack_context(const packet& pkt, stream_info& info)
+{
+    if (pkt.type != PACKET_CONTEXT || pkt.payload_words < 1) {
+        return false;
+    }
+
+    const uint32_t* p = pkt.payload;
+    const uint32_t* end = pkt.payload + pkt.payload_words;
+    uint32_t cif0 = ntohl(*p++);
+
+    // Any field ahead of the ones we produce would shift the layout
+    const uint32_t known = CIF0_CHANGE | CIF0_BANDWIDTH | CIF0_RF_REF_FREQ |
+                           CIF0_REF_LEVEL | CIF0_SAMPLE_RATE;
+    if (cif0 & ~known & 0xffe00000) {
+        return false;
+    }
+
+    if ((cif0 & CIF0_BANDWIDTH) && p + 2 <= end) {
+        info.bandwidth = unpack_fixed20(p);
+        p += 2;
+    }
+    if ((cif0 & CIF0_RF_REF_FREQ) && p + 2 <= end) {
+        info.center = unpack_fixed20(p);
+        p += 2;
+    }
+    if ((cif0 & CIF0_REF_LEVEL) && p + 1 <= end) {
+        info.reflevel = (int16_t)(ntohl(*p) & 0xffff) / 128.0;
+        p += 1;
+    }
+    if ((cif0 & CIF0_SAMPLE_RATE) && p + 2 <= end) {
+        info.sample_rate = unpack_fixed20(p);
+        p += 2;
+    }
+    info.ns_since_epoch = (int64_t)pkt.seconds * 1000000000 + pkt.picoseconds / 1000;
+    return true;
+}
+
+} // namespace vrt
+} // namespace signal_hound
+} // namespace gr
@@ -0,0 +1,81 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_VRT_PACKET_H
+#define INCLUDED_SIGNAL_HOUND_VRT_PACKET_H
+
+#include "stream_info.h"
+#include <gnuradio/gr_complex.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace gr {
+namespace signal_hound {
+namespace vrt {
+
+/*
+ * Minimal VITA-49.0 packing. Data packets are IF data with stream ID,
+ * UTC integer and real-time (picosecond) fractional timestamps, no class
+ * ID and no trailer. The payload is big-endian IEEE-754 single precision
+ * I/Q pairs. Context packets carry the bandwidth, RF reference frequency,
+ * reference level and sample rate fields of CIF0.
+ */
+
+const uint32_t PACKET_IF_DATA = 0x1;
+const uint32_t PACKET_CONTEXT = 0x4;
+
+const uint32_t CIF0_CHANGE = 1u << 31;
+const uint32_t CIF0_BANDWIDTH = 1u << 29;
+const uint32_t CIF0_RF_REF_FREQ = 1u << 27;
+const uint32_t CIF0_REF_LEVEL = 1u << 24;
+const uint32_t CIF0_SAMPLE_RATE = 1u << 21;
+
+//! Header, stream ID, integer and fractional timestamp
+const size_t PREFIX_WORDS = 5;
+const size_t CONTEXT_WORDS = PREFIX_WORDS + 8;
+const size_t MAX_PACKET_WORDS = 0xffff;
+
+inline size_t data_packet_words(size_t samples) { return PREFIX_WORDS + 2 * samples; }
+
+struct packet {
+    uint32_t type;
+    uint32_t count;
+    uint32_t stream_id;
+    uint32_t seconds;
+    uint64_t picoseconds;
+    const uint32_t* payload;
+    size_t payload_words;
+};
+
+//! Pack a data packet into \p words, returns the packet size in words.
+size_t pack_data(uint32_t* words,
+                 uint32_t stream_id,
+                 uint32_t count,
+                 int64_t ns_since_epoch,
+                 const gr_complex* iq,
+                 size_t samples);
+
+//! Pack a context packet into \p words, returns the packet size in words.
+size_t pack_context(uint32_t* words,
+                    uint32_t stream_id,
+                    uint32_t count,
+                    const stream_info& info,
+                    bool changed);
+
+//! Validate and split a received packet. Returns false if malformed.
+bool parse(const uint32_t* words, size_t len_words, packet& pkt);
+
+void unpack_data(const packet& pkt, gr_complex* iq);
+
+//! Update \p info with the fields present in a context packet
+bool unpack_context(const packet& pkt, stream_info& info);
+
+} // namespace vrt
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_VRT_PACKET_H */
@@ -0,0 +1,167 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "vrt_sender.h"
+#include "vrt_packet.h"
+#include <netdb.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+namespace gr {
+namespace signal_hound {
+
+// UDP payload that fits a 1500-byte Ethernet MTU without fragmenting
+static const size_t ETHERNET_PAYLOAD = 1500 - 20 - 8;
+
+// Packets handed to the kernel per sendmmsg() call
+static const size_t BATCH_PACKETS = 32;
+
+vrt_sender::vrt_sender(const std::string& destination,
+                       int samples_per_packet,
+                       uint32_t stream_id)
+    : _fd(-1),
+      _spp(samples_per_packet),
+      _stream_id(stream_id),
+      _data_count(0),
+      _context_count(0),
+      _context_interval(1000),
+      _since_context(0),
+      _have_info(false),
+      _queued(0),
+      _packets_sent(0),
+      _error_reported(false)
+{
+    if (samples_per_packet <= 0 ||
+        vrt::data_packet_words(samples_per_packet) > vrt::MAX_PACKET_WORDS) {
+        throw std::invalid_argument("vrt_sender: invalid samples per packet");
+    }
+
+    size_t colon = destination.rfind(':');
+    if (colon == std::string::npos) {
+        throw std::invalid_argument("vrt_sender: destination must be host:port");
+    }
+    std::string host = destination.substr(0, colon);
+    std::string port = destination.substr(colon + 1);
+
+    struct addrinfo hints;
+    memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_DGRAM;
+    struct addrinfo* res = nullptr;
+    if (getaddrinfo(host.c_str(), port.c_str(), &hints, &res) != 0 || !res) {
+        throw std::runtime_error("vrt_sender: cannot resolve " + destination);
+    }
+
+    _fd = socket(res->ai_family, res->ai_socktype, res->ai_protocol);
+    if (_fd < 0 || connect(_fd, res->ai_addr, res->ai_addrlen) < 0) {
+        freeaddrinfo(res);
+        if (_fd >= 0) {
+            close(_fd);
+        }
+        throw std::runtime_error("vrt_sender: cannot open socket to " + destination);
+    }
+    freeaddrinfo(res);
+
+    int sndbuf = 8 * 1024 * 1024;
+    setsockopt(_fd, SOL_SOCKET, SO_SNDBUF, &sndbuf, sizeof(sndbuf));
+
+    _slot_words = std::max(vrt::data_packet_words(_spp), vrt::CONTEXT_WORDS);
+    _storage.resize(_slot_words * BATCH_PACKETS);
+    _iov.resize(BATCH_PACKETS);
+    _msgs.resize(BATCH_PACKETS);
+    for (size_t i = 0; i < BATCH_PACKETS; i++) {
+        memset(&_msgs[i], 0, sizeof(struct mmsghdr));
+        _iov[i].iov_base = &_storage[i * _slot_words];
+        _msgs[i].msg_hdr.msg_iov = &_iov[i];
+        _msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    std::cout << "VRT stream " << _stream_id << " to " << destination << ", " << _spp
+              << " samples per packet" << std::endl;
+
+    size_t bytes = vrt::data_packet_words(_spp) * sizeof(uint32_t);
+    if (bytes > ETHERNET_PAYLOAD) {
+        std::cout << "** VRT Warning: " << bytes << " byte datagrams are fragmented "
+                  << "unless every link carries jumbo frames **" << std::endl;
+    }
+}
+
+vrt_sender::~vrt_sender()
+{
+    flush();
+    close(_fd);
+}
+
+void vrt_sender::queue_context(const stream_info& info, bool changed)
+{
+    if (_queued == BATCH_PACKETS) {
+        flush();
+    }
+    uint32_t* slot = &_storage[_queued * _slot_words];
+    size_t words = vrt::pack_context(slot, _stream_id, _context_count++, info, changed);
+    _iov[_queued++].iov_len = words * sizeof(uint32_t);
+    _since_context = 0;
+}
+
+void vrt_sender::send(const gr_complex* iq, int len, const stream_info& info)
+{
+    bool changed = !_have_info || info.tuning_differs(_last_info);
+    if (changed || _since_context >= _context_interval) {
+        queue_context(info, changed);
+        _last_info = info;
+        _have_info = true;
+    }
+
+    size_t offset = 0;
+    while (offset < (size_t)len) {
+        size_t n = std::min(_spp, (size_t)len - offset);
+        int64_t ns = info.ns_since_epoch;
+        if (ns && info.sample_rate > 0.0) {
+            ns += (int64_t)(offset * 1e9 / info.sample_rate);
+        }
+
+        if (_queued == BATCH_PACKETS) {
+            flush();
+        }
+        uint32_t* slot = &_storage[_queued * _slot_words];
+        size_t words = vrt::pack_data(slot, _stream_id, _data_count++, ns, iq + offset, n);
+        _iov[_queued++].iov_len = words * sizeof(uint32_t);
+        _since_context++;
+        offset += n;
+    }
+    flush();
+}
+
+void vrt_sender::flush()
+{
+    size_t sent = 0;
+    while (sent < _queued) {
+        int r = sendmmsg(_fd, &_msgs[sent], _queued - sent, 0);
+        if (r < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            // Typically ECONNREFUSED while nobody listens, keep streaming
+            if (!_error_reported) {
+                std::cout << "** VRT Warning: (sendmmsg) " << strerror(errno) << " **"
+                          << std::endl;
+                _error_reported = true;
+            }
+            break;
+        }
+        sent += r;
+    }
+    _packets_sent += sent;
+    _queued = 0;
+}
+
+} // namespace signal_hound
+} // namespace gr
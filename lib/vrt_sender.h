@@ -0,0 +1,72 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_VRT_SENDER_H
+#define INCLUDED_SIGNAL_HOUND_VRT_SENDER_H
+
+#include "stream_info.h"
+#include <gnuradio/gr_complex.h>
+#include <sys/socket.h>
+#include <string>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+/*!
+ * \brief Sends I/Q as VITA-49.0 packets over UDP straight from a source
+ * block's device read.
+ *
+ * Packets are built into a preallocated batch and handed to the kernel
+ * with a single sendmmsg() call. A context packet goes out whenever the
+ * tuning changes and otherwise every \p context_interval data packets.
+ */
+class vrt_sender
+{
+public:
+    /*!
+     * \param destination "host:port" of the receiver
+     * \param samples_per_packet I/Q samples in each data packet
+     * \param stream_id VRT stream identifier
+     */
+    vrt_sender(const std::string& destination,
+               int samples_per_packet = 180,
+               uint32_t stream_id = 1);
+    ~vrt_sender();
+
+    void send(const gr_complex* iq, int len, const stream_info& info);
+
+    uint64_t packets_sent() const { return _packets_sent; }
+
+private:
+    void queue_context(const stream_info& info, bool changed);
+    void flush();
+
+    int _fd;
+    size_t _spp;
+    uint32_t _stream_id;
+    uint32_t _data_count;
+    uint32_t _context_count;
+    int _context_interval;
+    int _since_context;
+    bool _have_info;
+    stream_info _last_info;
+
+    size_t _slot_words;
+    size_t _queued;
+    std::vector<uint32_t> _storage;
+    std::vector<struct iovec> _iov;
+    std::vector<struct mmsghdr> _msgs;
+
+    uint64_t _packets_sent;
+    bool _error_reported;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_VRT_SENDER_H */
@@ -0,0 +1,187 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "vrt_source_impl.h"
+#include "vrt_packet.h"
+#include <gnuradio/io_signature.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+
+namespace gr {
+namespace signal_hound {
+
+// Datagrams pulled from the socket per recvmmsg() call
+static const size_t BATCH_PACKETS = 32;
+static const size_t MAX_DATAGRAM_WORDS = 65536 / sizeof(uint32_t);
+
+using output_type = gr_complex;
+vrt_source::sptr vrt_source::make(const std::string& address, int port)
+{
+    return gnuradio::make_block_sptr<vrt_source_impl>(address, port);
+}
+
+
+/*
+ * The private constructor
+ */
+vrt_source_impl::vrt_source_impl(const std::string& address, int port)
+    : gr::sync_block("vrt_source",
+                     gr::io_signature::make(0, 0, 0),
+                     gr::io_signature::make(1 /* min outputs */, 1 /*max outputs */, sizeof(output_type))),
+      _fd(-1),
+      _pending_off(0),
+      _appended(0),
+      _have_count(false),
+      _last_count(0),
+      _lost(0),
+      _have_info(false)
+{
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1) {
+        throw std::invalid_argument("vrt_source: invalid address " + address);
+    }
+
+    _fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (_fd < 0) {
+        throw std::runtime_error(std::string("vrt_source: cannot open socket: ") +
+                                 strerror(errno));
+    }
+    int one = 1;
+    setsockopt(_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    int rcvbuf = 16 * 1024 * 1024;
+    setsockopt(_fd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+    if (bind(_fd, (struct sockaddr*)&addr, sizeof(addr)) < 0) {
+        close(_fd);
+        throw std::runtime_error("vrt_source: cannot bind " + address + ":" +
+                                 std::to_string(port) + ": " + strerror(errno));
+    }
+
+    _rx_storage.resize(BATCH_PACKETS * MAX_DATAGRAM_WORDS);
+    _iov.resize(BATCH_PACKETS);
+    _msgs.resize(BATCH_PACKETS);
+    for (size_t i = 0; i < BATCH_PACKETS; i++) {
+        memset(&_msgs[i], 0, sizeof(struct mmsghdr));
+        _iov[i].iov_base = &_rx_storage[i * MAX_DATAGRAM_WORDS];
+        _iov[i].iov_len = MAX_DATAGRAM_WORDS * sizeof(uint32_t);
+        _msgs[i].msg_hdr.msg_iov = &_iov[i];
+        _msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+}
+
+/*
+ * Our virtual destructor.
+ */
+vrt_source_impl::~vrt_source_impl() { close(_fd); }
+
+uint64_t vrt_source_impl::packets_lost() { return _lost; }
+
+void vrt_source_impl::queue_tag(const pmt::pmt_t& key, const pmt::pmt_t& value)
+{
+    gr::tag_t tag;
+    tag.offset = _appended;
+    tag.key = key;
+    tag.value = value;
+    _pending_tags.push_back(tag);
+}
+
+bool vrt_source_impl::receive(int timeout_ms)
+{
+    struct pollfd pfd = { _fd, POLLIN, 0 };
+    if (poll(&pfd, 1, timeout_ms) <= 0) {
+        return false;
+    }
+
+    int count = recvmmsg(_fd, &_msgs[0], BATCH_PACKETS, MSG_DONTWAIT, nullptr);
+    if (count <= 0) {
+        return false;
+    }
+
+    for (int i = 0; i < count; i++) {
+        vrt::packet pkt;
+        const uint32_t* words = &_rx_storage[i * MAX_DATAGRAM_WORDS];
+        if (!vrt::parse(words, _msgs[i].msg_len / sizeof(uint32_t), pkt)) {
+            continue;
+        }
+
+        if (pkt.type == vrt::PACKET_CONTEXT) {
+            vrt::unpack_context(pkt, _info);
+            if (!_have_info || _info.tuning_differs(_tagged_info)) {
+                queue_tag(pmt::mp("rx_freq"), pmt::from_double(_info.center));
+                queue_tag(pmt::mp("rx_rate"), pmt::from_double(_info.sample_rate));
+                _tagged_info = _info;
+                _have_info = true;
+            }
+            continue;
+        }
+
+        bool discontinuity = !_have_count;
+        if (_have_count && pkt.count != ((_last_count + 1) & 0xf)) {
+            _lost += (pkt.count - _last_count - 1) & 0xf;
+            discontinuity = true;
+        }
+        _have_count = true;
+        _last_count = pkt.count;
+
+        if (discontinuity) {
+            queue_tag(pmt::mp("rx_time"),
+                      pmt::make_tuple(pmt::from_uint64(pkt.seconds),
+                                      pmt::from_double(pkt.picoseconds * 1e-12)));
+        }
+
+        size_t samples = pkt.payload_words / 2;
+        size_t start = _pending.size();
+        _pending.resize(start + samples);
+        vrt::unpack_data(pkt, &_pending[start]);
+        _appended += samples;
+    }
+    return true;
+}
+
+int vrt_source_impl::work(int noutput_items,
+                          gr_vector_const_void_star& input_items,
+                          gr_vector_void_star& output_items)
+{
+    auto out = static_cast<output_type*>(output_items[0]);
+    int produced = 0;
+
+    while (produced < noutput_items) {
+        if (_pending_off < _pending.size()) {
+            size_t n = std::min(_pending.size() - _pending_off, (size_t)(noutput_items - produced));
+            memcpy(out + produced, &_pending[_pending_off], n * sizeof(output_type));
+            _pending_off += n;
+            produced += n;
+            continue;
+        }
+        _pending.clear();
+        _pending_off = 0;
+
+        // Only wait for the network when there is nothing to hand out
+        if (!receive(produced ? 0 : 100)) {
+            break;
+        }
+    }
+
+    uint64_t end = nitems_written(0) + produced;
+    while (!_pending_tags.empty() && _pending_tags.front().offset < end) {
+        add_item_tag(0, _pending_tags.front());
+        _pending_tags.pop_front();
+    }
+
+    return produced;
+}
+
+} /* namespace signal_hound */
+} /* namespace gr */
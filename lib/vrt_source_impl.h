@@ -0,0 +1,59 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_VRT_SOURCE_IMPL_H
+#define INCLUDED_SIGNAL_HOUND_VRT_SOURCE_IMPL_H
+
+#include "stream_info.h"
+#include <gnuradio/signal_hound/vrt_source.h>
+#include <sys/socket.h>
+#include <atomic>
+#include <deque>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+class vrt_source_impl : public vrt_source
+{
+private:
+    int _fd;
+
+    std::vector<uint32_t> _rx_storage;
+    std::vector<struct iovec> _iov;
+    std::vector<struct mmsghdr> _msgs;
+
+    std::vector<gr_complex> _pending;
+    size_t _pending_off;
+    std::deque<gr::tag_t> _pending_tags;
+    uint64_t _appended;
+
+    bool _have_count;
+    uint32_t _last_count;
+    std::atomic<uint64_t> _lost;
+    bool _have_info;
+    stream_info _info;
+    stream_info _tagged_info;
+
+    bool receive(int timeout_ms);
+    void queue_tag(const pmt::pmt_t& key, const pmt::pmt_t& value);
+
+public:
+    vrt_source_impl(const std::string& address, int port);
+    ~vrt_source_impl();
+
+    uint64_t packets_lost();
+
+    int work(int noutput_items,
+             gr_vector_const_void_star& input_items,
+             gr_vector_void_star& output_items);
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_VRT_SOURCE_IMPL_H */
@@ -0,0 +1,240 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "vsg_file_replay_impl.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
+namespace gr {
+namespace signal_hound {
+
+// Defined in vsg_series_impl.cc
+void ERROR_CHECK(const char* call, VsgStatus status);
+
+// Samples per vsgSubmitIQ call
+static const int SLICE = 1 << 16;
+// Slices read in ahead of the one being submitted
+static const int PREFETCH_SLICES = 8;
+// Segments larger than this are dropped from memory behind the replay
+static const size_t RESIDENT_LIMIT = 256u << 20;
+// How far submission may run ahead of the output
+static const double MAX_LEAD = 0.1;
+
+vsg_file_replay::sptr vsg_file_replay::make(const std::string& filename,
+                                            const std::string& format,
+                                            double center,
+                                            double samplerate,
+                                            double level,
+                                            bool repeat,
+                                            uint64_t start,
+                                            uint64_t count)
+{
+    return gnuradio::make_block_sptr<vsg_file_replay_impl>(
+        filename, format, center, samplerate, level, repeat, start, count);
+}
+
+
+/*
+ * The private constructor
+ */
+vsg_file_replay_impl::vsg_file_replay_impl(const std::string& filename,
+                                           const std::string& format,
+                                           double center,
+                                           double samplerate,
+                                           double level,
+                                           bool repeat,
+                                           uint64_t start,
+                                           uint64_t count)
+    : gr::block("vsg_file_replay", gr::io_signature::make(0, 0, 0), gr::io_signature::make(0, 0, 0)),
+      _handle(-1),
+      _repeat(repeat),
+      _center(center),
+      _samplerate(samplerate),
+      _level(level),
+      _param_changed(true),
+      _running(false),
+      _submitted(0)
+{
+    sigmf_meta meta = resolve_sample_file(filename, format);
+    if (_samplerate <= 0.0) {
+        _samplerate = meta.sample_rate;
+    }
+    if (_center <= 0.0) {
+        _center = meta.frequency;
+    }
+    if (_samplerate <= 0.0 || _center <= 0.0) {
+        throw std::invalid_argument("vsg_file_replay: no sample rate or frequency for " +
+                                    filename);
+    }
+
+    _file.reset(new mapped_file(meta.data_path));
+    _format = meta.format;
+
+    uint64_t total = _file->size() / (_format == SAMPLE_FC32 ? 8 : 4);
+    if (start >= total) {
+        throw std::invalid_argument("vsg_file_replay: segment starts past the end of " +
+                                    filename);
+    }
+    _start = start;
+    _end = count ? std::min(total, start + count) : total;
+
+    if (_format == SAMPLE_SC16) {
+        _convert.resize(2 * SLICE);
+    }
+
+    std::cout << "\nAPI Version: " << vsgGetAPIVersion() << std::endl;
+    // Open device in the background, start() waits for it
+    _open.reset(new device_open(
+        "VSG60", [this]() { ERROR_CHECK("vsgOpenDevice", vsgOpenDevice(&_handle)); }));
+
+    message_port_register_out(pmt::mp("done"));
+}
+
+/*
+ * Our virtual destructor.
+ */
+vsg_file_replay_impl::~vsg_file_replay_impl()
+{
+    _running = false;
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+    _open.reset();
+    if (_handle >= 0) {
+        vsgAbort(_handle);
+        vsgCloseDevice(_handle);
+    }
+}
+
+void vsg_file_replay_impl::set_center(double center)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _center = center;
+    _param_changed = true;
+}
+
+void vsg_file_replay_impl::set_level(double level)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _level = level;
+    _param_changed = true;
+}
+
+uint64_t vsg_file_replay_impl::samples_submitted() { return _submitted; }
+
+void vsg_file_replay_impl::configure()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    if (!_param_changed) {
+        return;
+    }
+    ERROR_CHECK("vsgSetFrequency", vsgSetFrequency(_handle, _center));
+    ERROR_CHECK("vsgSetSampleRate", vsgSetSampleRate(_handle, _samplerate));
+    ERROR_CHECK("vsgSetLevel", vsgSetLevel(_handle, _level));
+    _param_changed = false;
+}
+
+float* vsg_file_replay_impl::slice(uint64_t pos, int len)
+{
+    if (_format == SAMPLE_FC32) {
+        // The mapping is private, so the API can have it as is
+        return reinterpret_cast<float*>(_file->data() + pos * 8);
+    }
+
+    const int16_t* iq = reinterpret_cast<const int16_t*>(_file->data() + pos * 4);
+    volk_16i_s32f_convert_32f(&_convert[0], iq, 32768.0f, 2 * len);
+    return &_convert[0];
+}
+
+void vsg_file_replay_impl::run()
+{
+    typedef std::chrono::steady_clock clock;
+
+    const size_t sample_bytes = _format == SAMPLE_FC32 ? 8 : 4;
+    const bool release = (_end - _start) * sample_bytes > RESIDENT_LIMIT;
+
+    configure();
+    _file->prefetch(_start * sample_bytes, PREFETCH_SLICES * SLICE * sample_bytes);
+
+    clock::time_point t0;
+    uint64_t pos = _start;
+    uint64_t sent = 0;
+    while (_running) {
+        configure();
+
+        int len = std::min((uint64_t)SLICE, _end - pos);
+        _file->prefetch((pos + len) * sample_bytes, PREFETCH_SLICES * SLICE * sample_bytes);
+        float* iq = slice(pos, len);
+
+        // vsgSubmitIQ blocks once the API queue is full, which paces the
+        // stream. Also cap the lead so stop() and retunes take effect quickly.
+        // The API reports no underruns, so falling behind the host clock just
+        // moves the reference, it says nothing certain about the output.
+        if (sent == 0) {
+            t0 = clock::now();
+        } else {
+            double ahead = sent / _samplerate -
+                           std::chrono::duration<double>(clock::now() - t0).count();
+            if (ahead > MAX_LEAD) {
+                std::this_thread::sleep_for(std::chrono::duration<double>(ahead - MAX_LEAD));
+            } else if (ahead < 0.0) {
+                t0 = clock::now() - std::chrono::duration_cast<clock::duration>(
+                                        std::chrono::duration<double>(sent / _samplerate));
+            }
+        }
+
+        ERROR_CHECK("vsgSubmitIQ", vsgSubmitIQ(_handle, iq, len));
+        sent += len;
+        _submitted = sent;
+
+        if (release && pos >= _start + SLICE) {
+            _file->release((pos - SLICE) * sample_bytes, SLICE * sample_bytes);
+        }
+
+        pos += len;
+        if (pos == _end) {
+            if (!_repeat) {
+                break;
+            }
+            pos = _start;
+            _file->prefetch(_start * sample_bytes, PREFETCH_SLICES * SLICE * sample_bytes);
+        }
+    }
+
+    // Finished rather than stopped, let the tail play out
+    if (_running) {
+        vsgFlushAndWait(_handle);
+        message_port_pub(pmt::mp("done"), pmt::from_uint64(sent));
+    }
+}
+
+bool vsg_file_replay_impl::start()
+{
+    _open->wait();
+    _submitted = 0;
+    _running = true;
+    _thread = std::thread(&vsg_file_replay_impl::run, this);
+    return vsg_file_replay::start();
+}
+
+bool vsg_file_replay_impl::stop()
+{
+    _running = false;
+    if (_thread.joinable()) {
+        _thread.join();
+        if (_handle >= 0) {
+            vsgAbort(_handle);
+        }
+    }
+    return vsg_file_replay::stop();
+}
+
+} /* namespace signal_hound */
+} /* namespace gr */
@@ -0,0 +1,71 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_VSG_FILE_REPLAY_IMPL_H
+#define INCLUDED_SIGNAL_HOUND_VSG_FILE_REPLAY_IMPL_H
+
+#include "device_open.h"
+#include "mapped_file.h"
+#include "sigmf_meta.h"
+#include <gnuradio/signal_hound/vsg_api.h>
+#include <gnuradio/signal_hound/vsg_file_replay.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace gr {
+namespace signal_hound {
+
+class vsg_file_replay_impl : public vsg_file_replay
+{
+private:
+    int _handle;
+    std::unique_ptr<device_open> _open;
+
+    std::unique_ptr<mapped_file> _file;
+    sample_format _format;
+    uint64_t _start, _end;
+    bool _repeat;
+
+    double _center, _samplerate, _level;
+    gr::thread::mutex _mutex;
+    bool _param_changed;
+
+    std::thread _thread;
+    std::atomic<bool> _running;
+    std::atomic<uint64_t> _submitted;
+    std::vector<float> _convert;
+
+    void configure(void);
+    float* slice(uint64_t pos, int len);
+    void run(void);
+
+public:
+    vsg_file_replay_impl(const std::string& filename,
+                         const std::string& format,
+                         double center,
+                         double samplerate,
+                         double level,
+                         bool repeat,
+                         uint64_t start,
+                         uint64_t count);
+    ~vsg_file_replay_impl();
+
+    void set_center(double center);
+    void set_level(double level);
+
+    uint64_t samples_submitted();
+
+    bool start(void);
+    bool stop(void);
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_VSG_FILE_REPLAY_IMPL_H */
@@ -0,0 +1,173 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#include "vsg_monitor.h"
+#include <gnuradio/signal_hound/vsg_api.h>
+#include <cmath>
+#include <iostream>
+
+namespace gr {
+namespace signal_hound {
+
+static const auto POLL_PERIOD = std::chrono::seconds(1);
+// Blocking this much longer than the samples take to play is a stall
+static const double STALL_MARGIN = 0.05;
+
+vsg_monitor::vsg_monitor(gr::thread::mutex& device, report_fn report)
+    : _handle(-1),
+      _device(device),
+      _report(report),
+      _shutdown(false),
+      _active(false),
+      _drift(0.0),
+      _idle_gap(0.05),
+      _recal_temperature(0.0),
+      _have_recal_temperature(false),
+      _samples(0),
+      _polled_samples(0),
+      _polled_at(clock::now()),
+      _last_activity(clock::now()),
+      _usb_ok(true),
+      _health{ 0.0, 0.0, 0, 0, 0 }
+{
+}
+
+void vsg_monitor::start(int handle)
+{
+    _handle = handle;
+    _thread = std::thread(&vsg_monitor::run, this);
+}
+
+vsg_monitor::~vsg_monitor()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _shutdown = true;
+    }
+    _cond.notify_all();
+    if (_thread.joinable()) {
+        _thread.join();
+    }
+}
+
+void vsg_monitor::set_active(bool active)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (active && !_active) {
+        // Throughput covers streaming time only
+        _polled_samples = _samples;
+        _polled_at = clock::now();
+    }
+    _active = active;
+}
+
+void vsg_monitor::set_recal_policy(double drift, double idle_gap)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _drift = drift;
+    _idle_gap = idle_gap;
+}
+
+void vsg_monitor::submitted(int samples, double seconds, double sample_rate)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _samples += samples;
+    _last_activity = clock::now();
+
+    if (sample_rate > 0.0 && seconds > samples / sample_rate + STALL_MARGIN) {
+        // Warn once, stalls() keeps the count
+        if (_health.stalls++ == 0) {
+            std::cout << "** VSG stall: submitting " << samples / sample_rate * 1e3
+                      << " ms of samples blocked for " << seconds * 1e3 << " ms **"
+                      << std::endl;
+        }
+    }
+}
+
+vsg_health vsg_monitor::health() const
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _health;
+}
+
+void vsg_monitor::poll()
+{
+    float temperature = 0.0f;
+    VsgStatus usb;
+    {
+        gr::thread::scoped_lock device(_device);
+        vsgReadTemperature(_handle, &temperature);
+        usb = vsgGetUSBStatus(_handle);
+    }
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    auto now = clock::now();
+    double elapsed = std::chrono::duration<double>(now - _polled_at).count();
+    _health.temperature = temperature;
+    _health.throughput = elapsed > 0.0 ? (_samples - _polled_samples) / elapsed : 0.0;
+    _polled_samples = _samples;
+    _polled_at = now;
+
+    if (usb != vsgNoError) {
+        _health.usb_errors++;
+        if (_usb_ok) {
+            std::cout << "** VSG USB: " << vsgGetErrorString(usb) << " **" << std::endl;
+        }
+    }
+    _usb_ok = usb == vsgNoError;
+
+    if (!_have_recal_temperature) {
+        _recal_temperature = temperature;
+        _have_recal_temperature = true;
+    }
+
+    bool due = _drift > 0.0 && std::abs(temperature - _recal_temperature) >= _drift;
+    bool idle = std::chrono::duration<double>(now - _last_activity).count() >= _idle_gap;
+    if (due && idle) {
+        lock.unlock();
+        gr::thread::scoped_lock device(_device);
+        lock.lock();
+
+        // Output may have resumed while waiting for the device
+        if (std::chrono::duration<double>(clock::now() - _last_activity).count() >= _idle_gap) {
+            lock.unlock();
+            // Submitted samples may still be playing, and vsgRecal would cut
+            // them off. Holding the device keeps new ones out meanwhile.
+            vsgFlushAndWait(_handle);
+            VsgStatus status = vsgRecal(_handle);
+            lock.lock();
+            if (status == vsgNoError) {
+                std::cout << "VSG recalibrated at " << temperature << " C, "
+                          << temperature - _recal_temperature << " C drift" << std::endl;
+                _recal_temperature = temperature;
+                _health.recals++;
+            }
+        }
+    }
+
+    vsg_health health = _health;
+    lock.unlock();
+    if (_report) {
+        _report(health);
+    }
+}
+
+void vsg_monitor::run()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (!_cond.wait_for(lock, POLL_PERIOD, [this] { return _shutdown; })) {
+        if (!_active) {
+            continue;
+        }
+        lock.unlock();
+        poll();
+        lock.lock();
+    }
+}
+
+} // namespace signal_hound
+} // namespace gr
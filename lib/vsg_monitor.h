@@ -0,0 +1,101 @@
+/* -*- c++ -*- */
+/*
+ * Copyright 2025 Signal Hound.
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ */
+
+#ifndef INCLUDED_SIGNAL_HOUND_VSG_MONITOR_H
+#define INCLUDED_SIGNAL_HOUND_VSG_MONITOR_H
+
+#include <gnuradio/thread/thread.h>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace gr {
+namespace signal_hound {
+
+struct vsg_health {
+    double temperature; //!< Celsius
+    double throughput;  //!< Samples per second over the last poll period
+    uint64_t stalls;
+    uint64_t usb_errors;
+    uint64_t recals;
+};
+
+/*!
+ * \brief Watches a streaming VSG60 from a background thread.
+ *
+ * Every poll period the temperature and USB status are read and the link
+ * throughput is computed from the samples reported through submitted().
+ * A submission that blocks well past the time its samples take to play
+ * counts as a stall. When the temperature has drifted far enough since the
+ * last calibration, vsgRecal is run, but only once the stream has been idle
+ * for a minimum gap and vsgFlushAndWait has played out what was already
+ * submitted, because it aborts any output in progress.
+ *
+ * The owner serializes its own API calls with the monitor through the
+ * device mutex passed in. Polling begins once start() hands over the
+ * opened device, and only runs while the owner marks the stream active, so
+ * a stopped or standby device is left alone.
+ */
+class vsg_monitor
+{
+public:
+    typedef std::function<void(const vsg_health&)> report_fn;
+
+    vsg_monitor(gr::thread::mutex& device, report_fn report);
+    ~vsg_monitor();
+
+    //! Start polling the device \p handle
+    void start(int handle);
+
+    //! Resume or pause polling, as the stream starts and stops
+    void set_active(bool active);
+
+    //! Recalibrate after \p drift degrees C, once idle for \p idle_gap s.
+    //! A drift of zero or less disables recalibration.
+    void set_recal_policy(double drift, double idle_gap);
+
+    //! A vsgSubmitIQ call of \p samples samples took \p seconds
+    void submitted(int samples, double seconds, double sample_rate);
+
+    vsg_health health() const;
+
+private:
+    typedef std::chrono::steady_clock clock;
+
+    void run();
+    void poll();
+
+    int _handle;
+    gr::thread::mutex& _device;
+    report_fn _report;
+
+    mutable std::mutex _mutex;
+    std::condition_variable _cond;
+    std::thread _thread;
+    bool _shutdown;
+    bool _active;
+
+    double _drift;
+    double _idle_gap;
+    double _recal_temperature;
+    bool _have_recal_temperature;
+
+    uint64_t _samples;
+    uint64_t _polled_samples;
+    clock::time_point _polled_at;
+    clock::time_point _last_activity;
+    bool _usb_ok;
+    vsg_health _health;
+};
+
+} // namespace signal_hound
+} // namespace gr
+
+#endif /* INCLUDED_SIGNAL_HOUND_VSG_MONITOR_H */
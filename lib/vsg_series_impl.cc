@@ -6,7 +6,12 @@
  */
 
 #include "vsg_series_impl.h"
+#include "trace_span.h"
 #include <gnuradio/io_signature.h>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
 
 namespace gr {
 namespace signal_hound {
@@ -16,10 +21,11 @@ vsg_series::sptr vsg_series::make(double center,
                                   double samplerate,
                                   double level,
                                   int ioffset,
-                                  int qoffset)
+                                  int qoffset,
+                                  double idle_timeout)
 {
     return gnuradio::make_block_sptr<vsg_series_impl>(
-        center, samplerate, level, ioffset, qoffset);
+        center, samplerate, level, ioffset, qoffset, idle_timeout);
 }
 
 void ERROR_CHECK(const char* call, VsgStatus status)
@@ -42,7 +48,8 @@ vsg_series_impl::vsg_series_impl(double center,
                                  double samplerate,
                                  double level,
                                  int ioffset,
-                                 int qoffset) : 
+                                 int qoffset,
+                                 double idle_timeout) : 
     gr::sync_block("vsg_series",
     gr::io_signature::make(1 /* min inputs */, 1 /* max inputs */, sizeof(input_type)),
     gr::io_signature::make(0, 0, 0)),
@@ -54,20 +61,53 @@ vsg_series_impl::vsg_series_impl(double center,
     _qoffset(qoffset),
     _param_changed(true),
     _buffer(0),
-    _len(0) 
+    _len(0),
+    _actual_samplerate(samplerate),
+    _marker_interval(0.0),
+    _marker_bandwidth(0.0),
+    _marker_duration(0.0),
+    _marker_period(0),
+    _marker_countdown(0),
+    _marker_pos(0),
+    _hop_mode(false),
+    _hop_span(0.0),
+    _hop_dwell(0),
+    _hop_countdown(0),
+    _hop_index(0),
+    _anchor(center),
+    _rotating(false),
+    _digital_hops(0),
+    _retunes(0)
 {
     std::cout << "\nAPI Version: " << vsgGetAPIVersion() << std::endl;
 
-    // Open device
-    ERROR_CHECK("vsgOpenDevice", vsgOpenDevice(&_handle));
+    message_port_register_out(pmt::mp("status"));
+    _monitor.reset(new vsg_monitor(_device_mutex,
+                                   [this](const vsg_health& health) { publish_health(health); }));
 
-    int serial;
-    ERROR_CHECK("vsgGetSerialNumber", vsgGetSerialNumber(_handle, &serial));
-    std::cout << "Serial Number: "<< serial << std::endl;
+    // Open device in the background, start() waits for it
+    _open.reset(new device_open("VSG60", [this]() {
+        int handle;
+        ERROR_CHECK("vsgOpenDevice", vsgOpenDevice(&handle));
+
+        int serial;
+        ERROR_CHECK("vsgGetSerialNumber", vsgGetSerialNumber(handle, &serial));
+        std::cout << "Serial Number: "<< serial << std::endl;
+
+        gr::thread::scoped_lock lock(_mutex);
+        _handle = handle;
+        _monitor->start(_handle);
+    }));
+
+    _power.reset(new power_manager([this]() { enter_standby(); },
+                                   [this]() { leave_standby(); }));
+    _power->set_idle_timeout(idle_timeout);
 }
 
 void vsg_series_impl::configure() 
 {
+    SH_TRACE("config", "vsg_series::configure");
+    gr::thread::scoped_lock device(_device_mutex);
     gr::thread::scoped_lock lock(_mutex);
 
     // Configure
@@ -88,6 +128,13 @@ void vsg_series_impl::configure()
     std::cout << "Level: "<< aLeve << std::endl;
     std::cout << "I Offset: "<< aiOff << std::endl;
     std::cout << "Q Offset: "<< aqOff << std::endl;
+
+    _actual_samplerate = aSamp;
+    build_marker();
+
+    // A full configure puts the synthesizer back on the center frequency
+    _anchor = aFreq;
+    _rotating = false;
 }
 
 /*
@@ -95,8 +142,13 @@ void vsg_series_impl::configure()
  */
 vsg_series_impl::~vsg_series_impl()
 {
-    vsgAbort(_handle);
-    vsgCloseDevice(_handle);
+    _open.reset();
+    _monitor.reset();
+    _power.reset();
+    if(_handle >= 0) {
+        vsgAbort(_handle);
+        vsgCloseDevice(_handle);
+    }
     if (_buffer) {
         delete [] _buffer;
     }
@@ -138,11 +190,275 @@ void vsg_series_impl::set_qoffset(int qoffset)
     _param_changed = true;
 }
 
+void vsg_series_impl::set_idle_timeout(double seconds)
+{
+    _power->set_idle_timeout(seconds);
+}
+
+void vsg_series_impl::prewake()
+{
+    _power->prewake();
+}
+
+double vsg_series_impl::wake_latency()
+{
+    return _power->wake_latency();
+}
+
+void vsg_series_impl::set_latency_markers(double interval, double bandwidth, double duration)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _marker_interval = interval;
+    _marker_bandwidth = bandwidth;
+    _marker_duration = duration;
+    build_marker();
+}
+
+void vsg_series_impl::build_marker()
+{
+    _marker.clear();
+    _marker_pos = 0;
+    _marker_countdown = 0;
+    if(_marker_interval <= 0.0) {
+        return;
+    }
+
+    _marker = latency_marker::make_chirp(_actual_samplerate, _marker_bandwidth, _marker_duration);
+    _marker_period = std::max((uint64_t)(_marker_interval * _actual_samplerate),
+                              (uint64_t)_marker.size());
+}
+
+const gr_complex* vsg_series_impl::insert_markers(const gr_complex* in, int len)
+{
+    const gr_complex* tx = in;
+    int i = 0;
+    while(i < len) {
+        if(_marker_pos == 0 && _marker_countdown > 0) {
+            uint64_t skip = std::min(_marker_countdown, (uint64_t)(len - i));
+            _marker_countdown -= skip;
+            i += skip;
+            continue;
+        }
+
+        // Overwrite a copy, the input buffer belongs to the scheduler
+        if(tx == in) {
+            tx = writable(in, len);
+        }
+
+        if(_marker_pos == 0) {
+            _marker_starts.push_back(i);
+        }
+        size_t n = std::min(_marker.size() - _marker_pos, (size_t)(len - i));
+        memcpy(_buffer + i, &_marker[_marker_pos], n * sizeof(gr_complex));
+        _marker_pos += n;
+        i += n;
+        if(_marker_pos == _marker.size()) {
+            _marker_pos = 0;
+            _marker_countdown = _marker_period - _marker.size();
+        }
+    }
+    return tx;
+}
+
+gr_complex* vsg_series_impl::writable(const gr_complex* tx, int len)
+{
+    if(tx == _buffer) {
+        return _buffer;
+    }
+    if(!_buffer || len > _len) {
+        if(_buffer) delete [] _buffer;
+        _buffer = new std::complex<float>[len];
+        _len = len;
+    }
+    memcpy(_buffer, tx, len * sizeof(gr_complex));
+    return _buffer;
+}
+
+void vsg_series_impl::set_hop_mode(bool enabled, double span)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _hop_mode = enabled;
+    _hop_span = span;
+    if(!enabled && _rotating) {
+        // Put the synthesizer on the frequency reached digitally
+        _param_changed = true;
+    }
+}
+
+void vsg_series_impl::set_hop_list(const std::vector<double>& frequencies, double dwell)
+{
+    gr::thread::scoped_lock lock(_mutex);
+    _hop_list = frequencies;
+    _hop_dwell = std::max((uint64_t)1, (uint64_t)(dwell * _actual_samplerate));
+    _hop_countdown = 0;
+    _hop_index = 0;
+}
+
+uint64_t vsg_series_impl::digital_hops()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _digital_hops;
+}
+
+uint64_t vsg_series_impl::retunes()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    return _retunes;
+}
+
+void vsg_series_impl::set_recal_policy(double drift, double idle_gap)
+{
+    _monitor->set_recal_policy(drift, idle_gap);
+}
+
+double vsg_series_impl::temperature()
+{
+    return _monitor->health().temperature;
+}
+
+double vsg_series_impl::throughput()
+{
+    return _monitor->health().throughput;
+}
+
+uint64_t vsg_series_impl::stalls()
+{
+    return _monitor->health().stalls;
+}
+
+uint64_t vsg_series_impl::usb_errors()
+{
+    return _monitor->health().usb_errors;
+}
+
+uint64_t vsg_series_impl::recals()
+{
+    return _monitor->health().recals;
+}
+
+void vsg_series_impl::publish_health(const vsg_health& health)
+{
+    pmt::pmt_t status = pmt::make_dict();
+    status = pmt::dict_add(status, pmt::mp("temperature"), pmt::from_double(health.temperature));
+    status = pmt::dict_add(status, pmt::mp("throughput"), pmt::from_double(health.throughput));
+    status = pmt::dict_add(status, pmt::mp("stalls"), pmt::from_uint64(health.stalls));
+    status = pmt::dict_add(status, pmt::mp("usb_errors"), pmt::from_uint64(health.usb_errors));
+    status = pmt::dict_add(status, pmt::mp("recals"), pmt::from_uint64(health.recals));
+    message_port_pub(pmt::mp("status"), status);
+}
+
+void vsg_series_impl::hop(double frequency)
+{
+    double span = _hop_span > 0.0 ? _hop_span : _actual_samplerate / 2.0;
+    double offset = frequency - _anchor;
+    _center = frequency;
+
+    if(_hop_mode && std::abs(offset) <= span / 2.0) {
+        // Keep the phase continuous across digital hops
+        _rotator.set_phase_incr(std::polar(1.0f, (float)(2.0 * M_PI * offset / _actual_samplerate)));
+        _rotating = offset != 0.0;
+        _digital_hops++;
+    } else {
+        _segments.push_back({ 0, 0, frequency });
+        _anchor = frequency;
+        _rotating = false;
+        _retunes++;
+    }
+}
+
+/*
+ * Split a block of samples at its hops. Digital hops are applied to the
+ * samples here; synthesizer retunes are recorded in _segments to be made
+ * between vsgSubmitIQ calls, outside the lock.
+ */
+const gr_complex* vsg_series_impl::plan_hops(const gr_complex* tx, int len)
+{
+    _segments.clear();
+    _tags.clear();
+    get_tags_in_range(_tags, 0, nitems_read(0), nitems_read(0) + len, pmt::mp("tx_freq"));
+
+    size_t tag = 0;
+    int pos = 0;
+    while(pos < len) {
+        // Next hop from a tag or the hop list, whichever comes first
+        int next = len;
+        if(tag < _tags.size()) {
+            next = std::min(next, (int)(_tags[tag].offset - nitems_read(0)));
+        }
+        if(!_hop_list.empty()) {
+            next = std::min((uint64_t)next, pos + _hop_countdown);
+        }
+
+        if(next > pos) {
+            if(_rotating) {
+                gr_complex* buf = writable(tx, len);
+                _rotator.rotateN(buf + pos, buf + pos, next - pos);
+                tx = buf;
+            }
+            if(_segments.empty() || _segments.back().retune == 0.0 ||
+               _segments.back().len != 0) {
+                _segments.push_back({ pos, next - pos, 0.0 });
+            } else {
+                _segments.back().start = pos;
+                _segments.back().len = next - pos;
+            }
+            if(!_hop_list.empty()) {
+                _hop_countdown -= next - pos;
+            }
+            pos = next;
+            continue;
+        }
+
+        if(tag < _tags.size() && (int)(_tags[tag].offset - nitems_read(0)) == pos) {
+            hop(pmt::to_double(_tags[tag].value));
+            tag++;
+        } else {
+            hop(_hop_list[_hop_index]);
+            _hop_index = (_hop_index + 1) % _hop_list.size();
+            _hop_countdown = _hop_dwell;
+        }
+    }
+    return tx;
+}
+
+void vsg_series_impl::enter_standby()
+{
+    _monitor->set_active(false);
+    gr::thread::scoped_lock device(_device_mutex);
+    gr::thread::scoped_lock lock(_mutex);
+    if(_handle >= 0) {
+        vsgAbort(_handle);
+    }
+    vsgEnablePowerSavingCpuMode(vsgTrue);
+}
+
+void vsg_series_impl::leave_standby()
+{
+    gr::thread::scoped_lock lock(_mutex);
+    vsgEnablePowerSavingCpuMode(vsgFalse);
+    _param_changed = true;
+}
+
+bool vsg_series_impl::start()
+{
+    _open->wait();
+    _power->active();
+    _monitor->set_active(true);
+    return vsg_series::start();
+}
+
+bool vsg_series_impl::stop()
+{
+    _power->idle();
+    _monitor->set_active(false);
+    return vsg_series::stop();
+}
 
 int vsg_series_impl::work(int noutput_items,
                           gr_vector_const_void_star& input_items,
                           gr_vector_void_star& output_items)
 {
+    SH_TRACE("work", "vsg_series::work");
     auto in = static_cast<const input_type*>(input_items[0]);
 
     // Initiate new configuration if necessary
@@ -150,8 +466,44 @@ int vsg_series_impl::work(int noutput_items,
         configure();
         _param_changed = false;
     }
-    vsgSubmitIQ(_handle, (float*)in, noutput_items);
-    vsgFlush(_handle);
+
+    const input_type* tx = in;
+    {
+        gr::thread::scoped_lock lock(_mutex);
+        _marker_starts.clear();
+        if(!_marker.empty()) {
+            tx = insert_markers(in, noutput_items);
+        }
+        tx = plan_hops(tx, noutput_items);
+    }
+
+    // Retunes go between submissions so they land on the right sample
+    gr::thread::scoped_lock device(_device_mutex);
+    for(const hop_segment& seg : _segments) {
+        if(seg.retune != 0.0) {
+            SH_TRACE("device", "vsgSetFrequency");
+            ERROR_CHECK("vsgSetFrequency", vsgSetFrequency(_handle, seg.retune));
+        }
+        if(seg.len) {
+            SH_TRACE("device", "vsgSubmitIQ");
+            auto begin = std::chrono::steady_clock::now();
+            vsgSubmitIQ(_handle, (float*)(tx + seg.start), seg.len);
+            auto end = std::chrono::steady_clock::now();
+            std::chrono::duration<double> blocked = end - begin;
+            _monitor->submitted(seg.len, blocked.count(), _actual_samplerate);
+
+            // A marker counts as injected once the device has taken it
+            for(int start : _marker_starts) {
+                if(start >= seg.start && start < seg.start + seg.len) {
+                    latency_marker::injected(end);
+                }
+            }
+        }
+    }
+    {
+        SH_TRACE("device", "vsgFlush");
+        vsgFlush(_handle);
+    }
 
     // Tell runtime system how many output items we produced.
     return noutput_items;
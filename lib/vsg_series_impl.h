@@ -10,6 +10,12 @@
 
 #include <gnuradio/signal_hound/vsg_series.h>
 #include <gnuradio/signal_hound/vsg_api.h>
+#include "latency_marker.h"
+#include "device_open.h"
+#include "power_manager.h"
+#include "vsg_monitor.h"
+#include <gnuradio/blocks/rotator.h>
+#include <memory>
 
 namespace gr {
 namespace signal_hound {
@@ -28,12 +34,58 @@ private:
     std::complex<float> *_buffer;
     int _len;
 
+    std::unique_ptr<device_open> _open;
+    std::unique_ptr<power_manager> _power;
+
+    // Held around device I/O so the monitor never interleaves with it
+    gr::thread::mutex _device_mutex;
+    std::unique_ptr<vsg_monitor> _monitor;
+
+    double _actual_samplerate;
+    double _marker_interval, _marker_bandwidth, _marker_duration;
+    std::vector<gr_complex> _marker;
+    uint64_t _marker_period;
+    uint64_t _marker_countdown;
+    size_t _marker_pos;
+    std::vector<int> _marker_starts; // markers begun in this work call
+
+    // Hopping, _anchor is where the synthesizer is tuned
+    struct hop_segment {
+        int start;
+        int len;
+        double retune; //!< Synthesizer frequency to set first, 0 for none
+    };
+    bool _hop_mode;
+    double _hop_span;
+    std::vector<double> _hop_list;
+    uint64_t _hop_dwell;
+    uint64_t _hop_countdown;
+    size_t _hop_index;
+    double _anchor;
+    gr::blocks::rotator _rotator;
+    bool _rotating;
+    std::vector<hop_segment> _segments;
+    std::vector<gr::tag_t> _tags;
+    uint64_t _digital_hops;
+    uint64_t _retunes;
+
+    void publish_health(const vsg_health& health);
+    void enter_standby(void);
+    void leave_standby(void);
+
+    void build_marker(void);
+    const gr_complex* insert_markers(const gr_complex* in, int len);
+    gr_complex* writable(const gr_complex* tx, int len);
+    void hop(double frequency);
+    const gr_complex* plan_hops(const gr_complex* tx, int len);
+
 public:
     vsg_series_impl(double center,
                     double samplerate,
                     double level,
                     int ioffset,
-                    int qoffset);
+                    int qoffset,
+                    double idle_timeout);
     ~vsg_series_impl();
 
     void set_center(double center);
@@ -42,8 +94,29 @@ public:
     void set_ioffset(int ioffset);
     void set_qoffset(int qoffset);
 
+    void set_idle_timeout(double seconds);
+    void prewake(void);
+    double wake_latency(void);
+
+    void set_latency_markers(double interval, double bandwidth, double duration);
+
+    void set_hop_mode(bool enabled, double span);
+    void set_hop_list(const std::vector<double>& frequencies, double dwell);
+    uint64_t digital_hops(void);
+    uint64_t retunes(void);
+
+    void set_recal_policy(double drift, double idle_gap);
+    double temperature(void);
+    double throughput(void);
+    uint64_t stalls(void);
+    uint64_t usb_errors(void);
+    uint64_t recals(void);
+
     void configure(void);
 
+    bool start(void);
+    bool stop(void);
+
     // Where all the action really happens
     int work(int noutput_items,
              gr_vector_const_void_star& input_items,
@@ -0,0 +1,62 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(bb_direct_rf.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(a0f360f12970480f0420653221dac492)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/signal_hound/bb_direct_rf.h>
+// pydoc.h is automatically generated in the build directory
+#include <bb_direct_rf_pydoc.h>
+
+void bind_bb_direct_rf(py::module& m)
+{
+
+    using bb_direct_rf = ::gr::signal_hound::bb_direct_rf;
+
+
+    py::class_<bb_direct_rf,
+               gr::sync_block,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<bb_direct_rf>>(m, "bb_direct_rf", D(bb_direct_rf))
+
+        .def(py::init(&bb_direct_rf::make),
+             py::arg("reflevel"),
+             py::arg("hilbert") = false,
+             py::arg("taps") = 63,
+             D(bb_direct_rf, make))
+
+
+        .def("set_reflevel",
+             &bb_direct_rf::set_reflevel,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("reflevel"),
+             D(bb_direct_rf, set_reflevel))
+
+
+        .def("sample_rate",
+             &bb_direct_rf::sample_rate,
+             py::call_guard<py::gil_scoped_release>(),
+             D(bb_direct_rf, sample_rate))
+
+        ;
+}
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(bb_series.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(c3d7c9c719c4e6ff06c3311c86629f42)                     */
+/* BINDTOOL_HEADER_FILE_HASH(645ebce32cb8f593034f947705acb8f2)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -45,35 +45,128 @@ void bind_bb_series(py::module& m)
              py::arg("decimation"),
              py::arg("bandwidth"),
              py::arg("purge"),
+             py::arg("idle_timeout") = 0.0,
+             py::arg("replay") = "",
+             py::arg("replay_paced") = true,
+             py::arg("vlen") = 1,
+             py::arg("overlap") = 0,
              D(bb_series, make))
 
 
         .def("set_center",
              &bb_series::set_center,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("center"),
              D(bb_series, set_center))
 
 
         .def("set_reflevel",
              &bb_series::set_reflevel,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("reflevel"),
              D(bb_series, set_reflevel))
 
 
         .def("set_decimation",
              &bb_series::set_decimation,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("decimation"),
              D(bb_series, set_decimation))
 
 
-        .def(
-            "set_purge", &bb_series::set_purge, py::arg("purge"), D(bb_series, set_purge))
+        .def("set_purge",
+             &bb_series::set_purge,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("purge"),
+             D(bb_series, set_purge))
 
 
         .def("set_bandwidth",
              &bb_series::set_bandwidth,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("bandwidth"),
              D(bb_series, set_bandwidth))
 
+
+        .def("set_idle_timeout",
+             &bb_series::set_idle_timeout,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("seconds"),
+             D(bb_series, set_idle_timeout))
+
+
+        .def("prewake",
+             &bb_series::prewake,
+             py::call_guard<py::gil_scoped_release>(),
+             D(bb_series, prewake))
+
+
+        .def("wake_latency",
+             &bb_series::wake_latency,
+             py::call_guard<py::gil_scoped_release>(),
+             D(bb_series, wake_latency))
+
+
+        .def("overruns",
+             &bb_series::overruns,
+             py::call_guard<py::gil_scoped_release>(),
+             D(bb_series, overruns))
+
+
+        .def("set_vrt_destination",
+             &bb_series::set_vrt_destination,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("destination"),
+             py::arg("samples_per_packet") = 180,
+             D(bb_series, set_vrt_destination))
+
+
+        .def("set_shm_publish",
+             &bb_series::set_shm_publish,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("name"),
+             py::arg("capacity") = 1 << 24,
+             D(bb_series, set_shm_publish))
+
+
+        .def("set_recording",
+             &bb_series::set_recording,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("path"),
+             py::arg("mantissa_bits") = 8,
+             py::arg("max_error") = 0.0,
+             D(bb_series, set_recording))
+
+
+        .def("set_pdu_output",
+             &bb_series::set_pdu_output,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("samples_per_pdu"),
+             py::arg("pool_size") = 64,
+             D(bb_series, set_pdu_output))
+
+
+        .def("set_read_latency",
+             &bb_series::set_read_latency,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("seconds"),
+             D(bb_series, set_read_latency))
+
+
+        .def("set_output_rate",
+             &bb_series::set_output_rate,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("rate"),
+             D(bb_series, set_output_rate))
+
+
+        .def("set_time_source",
+             &bb_series::set_time_source,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("source"),
+             py::arg("com_port") = 0,
+             py::arg("baud_rate") = 38400,
+             D(bb_series, set_time_source))
+
         ;
 }
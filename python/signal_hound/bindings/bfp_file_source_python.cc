@@ -0,0 +1,61 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(bfp_file_source.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(c99120b4505c1d102e6e3faca320445e)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/signal_hound/bfp_file_source.h>
+// pydoc.h is automatically generated in the build directory
+#include <bfp_file_source_pydoc.h>
+
+void bind_bfp_file_source(py::module& m)
+{
+
+    using bfp_file_source = ::gr::signal_hound::bfp_file_source;
+
+
+    py::class_<bfp_file_source,
+               gr::sync_block,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<bfp_file_source>>(m, "bfp_file_source", D(bfp_file_source))
+
+        .def(py::init(&bfp_file_source::make),
+             py::arg("filename"),
+             py::arg("repeat") = false,
+             D(bfp_file_source, make))
+
+
+        .def("seek",
+             &bfp_file_source::seek,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("sample"),
+             D(bfp_file_source, seek))
+
+
+        .def("samples",
+             &bfp_file_source::samples,
+             py::call_guard<py::gil_scoped_release>(),
+             D(bfp_file_source, samples))
+
+        ;
+}
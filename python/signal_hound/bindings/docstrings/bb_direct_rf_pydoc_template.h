@@ -0,0 +1,33 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, signal_hound, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_signal_hound_bb_direct_rf = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_bb_direct_rf_bb_direct_rf_0 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_bb_direct_rf_bb_direct_rf_1 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_bb_direct_rf_make = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_bb_direct_rf_set_reflevel = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_bb_direct_rf_sample_rate = R"doc()doc";
@@ -0,0 +1,51 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, signal_hound, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_signal_hound_latency_probe = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_latency_probe_latency_probe_0 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_latency_probe_latency_probe_1 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_latency_probe_make = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_latency_probe_histogram = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_latency_probe_bin_width = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_latency_probe_detections = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_latency_probe_unmatched = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_latency_probe_min_latency = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_latency_probe_mean_latency = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_latency_probe_max_latency = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_latency_probe_reset = R"doc()doc";
@@ -0,0 +1,72 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, signal_hound, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_sm_cue_capture_0 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_sm_cue_capture_1 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_make = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_set_span = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_set_rbw = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_set_reflevel = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_set_threshold = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_set_mask = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_set_capture = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_set_mode = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_set_max_captures = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_set_holdoff = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_set_dwell = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_sweeps = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_captures = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_last_reaction_time = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_mean_reaction_time = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_cue_capture_max_reaction_time = R"doc()doc";
@@ -58,3 +58,39 @@ static const char* __doc_gr_signal_hound_sm_series_set_deviceAddr = R"doc()doc";
 
 
 static const char* __doc_gr_signal_hound_sm_series_set_port = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_series_set_idle_timeout = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_series_prewake = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_series_wake_latency = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_series_overruns = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_series_set_vrt_destination = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_series_set_shm_publish = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_series_set_recording = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_series_set_pdu_output = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_series_set_read_latency = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_series_set_base_rate = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_series_valid_decimations = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sm_series_set_output_rate = R"doc()doc";
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, signal_hound, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_signal_hound_sweep_accumulator = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_accumulator_sweep_accumulator_0 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_accumulator_sweep_accumulator_1 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_accumulator_make = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_accumulator_set_average = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_accumulator_set_threshold = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_accumulator_set_interval = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_accumulator_set_reset_on_snapshot = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_accumulator_reset = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_accumulator_sweeps = R"doc()doc";
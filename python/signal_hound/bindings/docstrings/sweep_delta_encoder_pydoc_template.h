@@ -0,0 +1,42 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, signal_hound, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_signal_hound_sweep_delta_encoder = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_delta_encoder_sweep_delta_encoder_0 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_delta_encoder_sweep_delta_encoder_1 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_delta_encoder_make = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_delta_encoder_set_threshold = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_delta_encoder_set_key_interval = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_delta_encoder_compression_ratio = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_delta_encoder_frames = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_delta_encoder_key_frames = R"doc()doc";
@@ -0,0 +1,45 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, signal_hound, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_signal_hound_sweep_mask = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_mask_sweep_mask_0 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_mask_sweep_mask_1 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_mask_make = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_mask_set_threshold = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_mask_set_mask = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_mask_set_hysteresis = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_mask_set_peaks = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_mask_sweeps = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_sweep_mask_violating_sweeps = R"doc()doc";
@@ -0,0 +1,30 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, signal_hound, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_signal_hound_vrt_source = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vrt_source_vrt_source_0 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vrt_source_vrt_source_1 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vrt_source_make = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vrt_source_packets_lost = R"doc()doc";
@@ -0,0 +1,36 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+#include "pydoc_macros.h"
+#define D(...) DOC(gr, signal_hound, __VA_ARGS__)
+/*
+  This file contains placeholders for docstrings for the Python bindings.
+  Do not edit! These were automatically extracted during the binding process
+  and will be overwritten during the build process
+ */
+
+
+static const char* __doc_gr_signal_hound_vsg_file_replay = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_file_replay_vsg_file_replay_0 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_file_replay_vsg_file_replay_1 = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_file_replay_make = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_file_replay_set_center = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_file_replay_set_level = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_file_replay_samples_submitted = R"doc()doc";
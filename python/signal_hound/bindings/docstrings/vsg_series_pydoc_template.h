@@ -40,3 +40,45 @@ static const char* __doc_gr_signal_hound_vsg_series_set_ioffset = R"doc()doc";
 
 
 static const char* __doc_gr_signal_hound_vsg_series_set_qoffset = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_set_idle_timeout = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_prewake = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_wake_latency = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_set_latency_markers = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_set_hop_mode = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_set_hop_list = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_digital_hops = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_retunes = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_set_recal_policy = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_temperature = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_throughput = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_stalls = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_usb_errors = R"doc()doc";
+
+
+static const char* __doc_gr_signal_hound_vsg_series_recals = R"doc()doc";
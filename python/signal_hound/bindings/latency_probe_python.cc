@@ -0,0 +1,100 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(latency_probe.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(f192a1081eebb0784ff5b6da306b6bb5)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/signal_hound/latency_probe.h>
+// pydoc.h is automatically generated in the build directory
+#include <latency_probe_pydoc.h>
+
+void bind_latency_probe(py::module& m)
+{
+
+    using latency_probe = ::gr::signal_hound::latency_probe;
+
+
+    py::class_<latency_probe,
+               gr::sync_block,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<latency_probe>>(m, "latency_probe", D(latency_probe))
+
+        .def(py::init(&latency_probe::make),
+             py::arg("sample_rate"),
+             py::arg("bandwidth") = 1e6,
+             py::arg("duration") = 1e-3,
+             py::arg("threshold") = 0.5,
+             py::arg("bin_width") = 1e-4,
+             py::arg("bins") = 1000,
+             D(latency_probe, make))
+
+
+        .def("histogram",
+             &latency_probe::histogram,
+             py::call_guard<py::gil_scoped_release>(),
+             D(latency_probe, histogram))
+
+
+        .def("bin_width",
+             &latency_probe::bin_width,
+             py::call_guard<py::gil_scoped_release>(),
+             D(latency_probe, bin_width))
+
+
+        .def("detections",
+             &latency_probe::detections,
+             py::call_guard<py::gil_scoped_release>(),
+             D(latency_probe, detections))
+
+
+        .def("unmatched",
+             &latency_probe::unmatched,
+             py::call_guard<py::gil_scoped_release>(),
+             D(latency_probe, unmatched))
+
+
+        .def("min_latency",
+             &latency_probe::min_latency,
+             py::call_guard<py::gil_scoped_release>(),
+             D(latency_probe, min_latency))
+
+
+        .def("mean_latency",
+             &latency_probe::mean_latency,
+             py::call_guard<py::gil_scoped_release>(),
+             D(latency_probe, mean_latency))
+
+
+        .def("max_latency",
+             &latency_probe::max_latency,
+             py::call_guard<py::gil_scoped_release>(),
+             D(latency_probe, max_latency))
+
+
+        .def("reset",
+             &latency_probe::reset,
+             py::call_guard<py::gil_scoped_release>(),
+             D(latency_probe, reset))
+
+        ;
+}
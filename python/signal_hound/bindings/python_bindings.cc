@@ -25,6 +25,20 @@ namespace py = pybind11;
     void bind_sp_series(py::module& m);
     void bind_sm_series(py::module& m);
     void bind_vsg_series(py::module& m);
+    void bind_vrt_source(py::module& m);
+    void bind_shm_source(py::module& m);
+    void bind_bfp_file_source(py::module& m);
+    void bind_latency_probe(py::module& m);
+    void bind_vsg_file_replay(py::module& m);
+#ifdef ENABLE_BB_DIRECT_RF
+    void bind_bb_direct_rf(py::module& m);
+#endif
+    void bind_sm_cue_capture(py::module& m);
+    void bind_sweep_accumulator(py::module& m);
+    void bind_sweep_mask(py::module& m);
+    void bind_sweep_delta_encoder(py::module& m);
+    void bind_sweep_delta_decoder(py::module& m);
+    void bind_tracing(py::module& m);
 // ) END BINDING_FUNCTION_PROTOTYPES
 
 
@@ -57,5 +71,19 @@ PYBIND11_MODULE(signal_hound_python, m)
     bind_sp_series(m);
     bind_sm_series(m);
     bind_vsg_series(m);
+    bind_vrt_source(m);
+    bind_shm_source(m);
+    bind_bfp_file_source(m);
+    bind_latency_probe(m);
+    bind_vsg_file_replay(m);
+#ifdef ENABLE_BB_DIRECT_RF
+    bind_bb_direct_rf(m);
+#endif
+    bind_sm_cue_capture(m);
+    bind_sweep_accumulator(m);
+    bind_sweep_mask(m);
+    bind_sweep_delta_encoder(m);
+    bind_sweep_delta_decoder(m);
+    bind_tracing(m);
     // ) END BINDING_FUNCTION_CALLS
 }
\ No newline at end of file
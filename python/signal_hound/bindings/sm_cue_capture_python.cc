@@ -0,0 +1,163 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(sm_cue_capture.h)                                         */
+/* BINDTOOL_HEADER_FILE_HASH(f90d488e373adaf176ec891cf4dc98f9)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/signal_hound/sm_cue_capture.h>
+// pydoc.h is automatically generated in the build directory
+#include <sm_cue_capture_pydoc.h>
+
+void bind_sm_cue_capture(py::module& m)
+{
+
+    using sm_cue_capture = ::gr::signal_hound::sm_cue_capture;
+
+
+    py::class_<sm_cue_capture,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<sm_cue_capture>>(m, "sm_cue_capture", D(sm_cue_capture))
+
+        .def(py::init(&sm_cue_capture::make),
+             py::arg("start"),
+             py::arg("stop"),
+             py::arg("rbw"),
+             py::arg("reflevel"),
+             py::arg("threshold"),
+             py::arg("capture_len") = 16384,
+             py::arg("decimation") = 8,
+             py::arg("mode") = "segmented",
+             py::arg("max_captures") = 4,
+             py::arg("holdoff") = 1.0,
+             py::arg("dwell") = 0.1,
+             py::arg("type") = "SM200B",
+             py::arg("hostAddr") = "192.168.2.2",
+             py::arg("deviceAddr") = "192.168.2.10",
+             py::arg("port") = 51665,
+             D(sm_cue_capture, make))
+
+
+        .def("set_span",
+             &sm_cue_capture::set_span,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("start"),
+             py::arg("stop"),
+             D(sm_cue_capture, set_span))
+
+
+        .def("set_rbw",
+             &sm_cue_capture::set_rbw,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("rbw"),
+             D(sm_cue_capture, set_rbw))
+
+
+        .def("set_reflevel",
+             &sm_cue_capture::set_reflevel,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("reflevel"),
+             D(sm_cue_capture, set_reflevel))
+
+
+        .def("set_threshold",
+             &sm_cue_capture::set_threshold,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("threshold"),
+             D(sm_cue_capture, set_threshold))
+
+
+        .def("set_mask",
+             &sm_cue_capture::set_mask,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("freqs"),
+             py::arg("levels"),
+             D(sm_cue_capture, set_mask))
+
+
+        .def("set_capture",
+             &sm_cue_capture::set_capture,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("capture_len"),
+             py::arg("decimation"),
+             D(sm_cue_capture, set_capture))
+
+
+        .def("set_mode",
+             &sm_cue_capture::set_mode,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("mode"),
+             D(sm_cue_capture, set_mode))
+
+
+        .def("set_max_captures",
+             &sm_cue_capture::set_max_captures,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("max_captures"),
+             D(sm_cue_capture, set_max_captures))
+
+
+        .def("set_holdoff",
+             &sm_cue_capture::set_holdoff,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("holdoff"),
+             D(sm_cue_capture, set_holdoff))
+
+
+        .def("set_dwell",
+             &sm_cue_capture::set_dwell,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("dwell"),
+             D(sm_cue_capture, set_dwell))
+
+
+        .def("sweeps",
+             &sm_cue_capture::sweeps,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sm_cue_capture, sweeps))
+
+
+        .def("captures",
+             &sm_cue_capture::captures,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sm_cue_capture, captures))
+
+
+        .def("last_reaction_time",
+             &sm_cue_capture::last_reaction_time,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sm_cue_capture, last_reaction_time))
+
+
+        .def("mean_reaction_time",
+             &sm_cue_capture::mean_reaction_time,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sm_cue_capture, mean_reaction_time))
+
+
+        .def("max_reaction_time",
+             &sm_cue_capture::max_reaction_time,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sm_cue_capture, max_reaction_time))
+
+        ;
+}
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(sm_series.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(93d555963dfd60fc7ff406a9a6148fa5)                     */
+/* BINDTOOL_HEADER_FILE_HASH(e4ef1ae8248e6771cf001e168d1b5e74)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -48,6 +48,11 @@ void bind_sm_series(py::module& m)
            py::arg("hostAddr"),
            py::arg("deviceAddr"),
            py::arg("port"),
+           py::arg("idle_timeout") = 0.0,
+           py::arg("replay") = "",
+           py::arg("replay_paced") = true,
+           py::arg("vlen") = 1,
+           py::arg("overlap") = 0,
            D(sm_series,make)
         )
         
@@ -57,6 +62,7 @@ void bind_sm_series(py::module& m)
 
         
         .def("set_center",&sm_series::set_center,       
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("center"),
             D(sm_series,set_center)
         )
@@ -64,6 +70,7 @@ void bind_sm_series(py::module& m)
 
         
         .def("set_reflevel",&sm_series::set_reflevel,       
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("reflevel"),
             D(sm_series,set_reflevel)
         )
@@ -71,6 +78,7 @@ void bind_sm_series(py::module& m)
 
         
         .def("set_atten",&sm_series::set_atten,       
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("atten"),
             D(sm_series,set_atten)
         )
@@ -78,6 +86,7 @@ void bind_sm_series(py::module& m)
 
         
         .def("set_decimation",&sm_series::set_decimation,       
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("decimation"),
             D(sm_series,set_decimation)
         )
@@ -85,6 +94,7 @@ void bind_sm_series(py::module& m)
 
         
         .def("set_swfilter",&sm_series::set_swfilter,       
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("swfilter"),
             D(sm_series,set_swfilter)
         )
@@ -92,6 +102,7 @@ void bind_sm_series(py::module& m)
 
         
         .def("set_purge",&sm_series::set_purge,       
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("purge"),
             D(sm_series,set_purge)
         )
@@ -99,6 +110,7 @@ void bind_sm_series(py::module& m)
 
         
         .def("set_bandwidth",&sm_series::set_bandwidth,       
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("bandwidth"),
             D(sm_series,set_bandwidth)
         )
@@ -106,6 +118,7 @@ void bind_sm_series(py::module& m)
 
         
         .def("set_type",&sm_series::set_type,       
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("type"),
             D(sm_series,set_type)
         )
@@ -113,6 +126,7 @@ void bind_sm_series(py::module& m)
 
         
         .def("set_hostAddr",&sm_series::set_hostAddr,       
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("hostAddr"),
             D(sm_series,set_hostAddr)
         )
@@ -120,6 +134,7 @@ void bind_sm_series(py::module& m)
 
         
         .def("set_deviceAddr",&sm_series::set_deviceAddr,       
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("hostAddr"),
             D(sm_series,set_deviceAddr)
         )
@@ -127,10 +142,110 @@ void bind_sm_series(py::module& m)
 
         
         .def("set_port",&sm_series::set_port,       
+            py::call_guard<py::gil_scoped_release>(),
             py::arg("port"),
             D(sm_series,set_port)
         )
 
+
+        
+        .def("set_idle_timeout",&sm_series::set_idle_timeout,       
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("seconds"),
+            D(sm_series,set_idle_timeout)
+        )
+
+
+        
+        .def("prewake",&sm_series::prewake,       
+            py::call_guard<py::gil_scoped_release>(),
+            D(sm_series,prewake)
+        )
+
+
+        
+        .def("wake_latency",&sm_series::wake_latency,       
+            py::call_guard<py::gil_scoped_release>(),
+            D(sm_series,wake_latency)
+        )
+
+
+        
+        .def("overruns",&sm_series::overruns,       
+            py::call_guard<py::gil_scoped_release>(),
+            D(sm_series,overruns)
+        )
+
+
+        
+        .def("set_vrt_destination",&sm_series::set_vrt_destination,       
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("destination"),
+            py::arg("samples_per_packet") = 180,
+            D(sm_series,set_vrt_destination)
+        )
+
+
+        
+        .def("set_shm_publish",&sm_series::set_shm_publish,       
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("name"),
+            py::arg("capacity") = 1 << 24,
+            D(sm_series,set_shm_publish)
+        )
+
+
+        
+        .def("set_recording",&sm_series::set_recording,       
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("path"),
+            py::arg("mantissa_bits") = 8,
+            py::arg("max_error") = 0.0,
+            D(sm_series,set_recording)
+        )
+
+
+
+        
+        .def("set_pdu_output",&sm_series::set_pdu_output,       
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("samples_per_pdu"),
+            py::arg("pool_size") = 64,
+            D(sm_series,set_pdu_output)
+        )
+
+
+        
+        .def("set_read_latency",&sm_series::set_read_latency,       
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("seconds"),
+            D(sm_series,set_read_latency)
+        )
+
+
+        
+        .def("set_base_rate",&sm_series::set_base_rate,       
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("base"),
+            D(sm_series,set_base_rate)
+        )
+
+
+        
+        .def("valid_decimations",&sm_series::valid_decimations,       
+            py::call_guard<py::gil_scoped_release>(),
+            D(sm_series,valid_decimations)
+        )
+
+
+
+        
+        .def("set_output_rate",&sm_series::set_output_rate,       
+            py::call_guard<py::gil_scoped_release>(),
+            py::arg("rate"),
+            D(sm_series,set_output_rate)
+        )
+
         ;
 
 
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(sp_series.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(28772d74f5dbaa111ac9b1900bd9bb18)                     */
+/* BINDTOOL_HEADER_FILE_HASH(5f03af2349097bf0d33aef653f099237)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -47,45 +47,133 @@ void bind_sp_series(py::module& m)
              py::arg("swfilter"),
              py::arg("bandwidth"),
              py::arg("purge"),
+             py::arg("idle_timeout") = 0.0,
+             py::arg("replay") = "",
+             py::arg("replay_paced") = true,
+             py::arg("vlen") = 1,
+             py::arg("overlap") = 0,
              D(sp_series, make))
 
 
         .def("set_center",
              &sp_series::set_center,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("center"),
              D(sp_series, set_center))
 
 
         .def("set_reflevel",
              &sp_series::set_reflevel,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("reflevel"),
              D(sp_series, set_reflevel))
 
 
-        .def(
-            "set_atten", &sp_series::set_atten, py::arg("atten"), D(sp_series, set_atten))
+        .def("set_atten",
+             &sp_series::set_atten,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("atten"),
+             D(sp_series, set_atten))
 
 
         .def("set_decimation",
              &sp_series::set_decimation,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("decimation"),
              D(sp_series, set_decimation))
 
 
         .def("set_swfilter",
              &sp_series::set_swfilter,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("swfilter"),
              D(sp_series, set_swfilter))
 
 
-        .def(
-            "set_purge", &sp_series::set_purge, py::arg("purge"), D(sp_series, set_purge))
+        .def("set_purge",
+             &sp_series::set_purge,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("purge"),
+             D(sp_series, set_purge))
 
 
         .def("set_bandwidth",
              &sp_series::set_bandwidth,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("bandwidth"),
              D(sp_series, set_bandwidth))
 
+
+        .def("set_idle_timeout",
+             &sp_series::set_idle_timeout,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("seconds"),
+             D(sp_series, set_idle_timeout))
+
+
+        .def("prewake",
+             &sp_series::prewake,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sp_series, prewake))
+
+
+        .def("wake_latency",
+             &sp_series::wake_latency,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sp_series, wake_latency))
+
+
+        .def("overruns",
+             &sp_series::overruns,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sp_series, overruns))
+
+
+        .def("set_vrt_destination",
+             &sp_series::set_vrt_destination,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("destination"),
+             py::arg("samples_per_packet") = 180,
+             D(sp_series, set_vrt_destination))
+
+
+        .def("set_shm_publish",
+             &sp_series::set_shm_publish,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("name"),
+             py::arg("capacity") = 1 << 24,
+             D(sp_series, set_shm_publish))
+
+
+        .def("set_recording",
+             &sp_series::set_recording,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("path"),
+             py::arg("mantissa_bits") = 8,
+             py::arg("max_error") = 0.0,
+             D(sp_series, set_recording))
+
+
+        .def("set_pdu_output",
+             &sp_series::set_pdu_output,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("samples_per_pdu"),
+             py::arg("pool_size") = 64,
+             D(sp_series, set_pdu_output))
+
+
+        .def("set_read_latency",
+             &sp_series::set_read_latency,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("seconds"),
+             D(sp_series, set_read_latency))
+
+
+        .def("set_output_rate",
+             &sp_series::set_output_rate,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("rate"),
+             D(sp_series, set_output_rate))
+
         ;
 }
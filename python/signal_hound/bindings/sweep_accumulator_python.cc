@@ -0,0 +1,91 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(sweep_accumulator.h)                                      */
+/* BINDTOOL_HEADER_FILE_HASH(88fd4f29f38eeee1052a0cba05c66490)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/signal_hound/sweep_accumulator.h>
+// pydoc.h is automatically generated in the build directory
+#include <sweep_accumulator_pydoc.h>
+
+void bind_sweep_accumulator(py::module& m)
+{
+
+    using sweep_accumulator = ::gr::signal_hound::sweep_accumulator;
+
+
+    py::class_<sweep_accumulator,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<sweep_accumulator>>(m, "sweep_accumulator", D(sweep_accumulator))
+
+        .def(py::init(&sweep_accumulator::make),
+             py::arg("average") = "linear",
+             py::arg("alpha") = 0.1,
+             py::arg("threshold") = -80.0,
+             py::arg("interval") = 1.0,
+             py::arg("reset_on_snapshot") = false,
+             D(sweep_accumulator, make))
+
+
+        .def("set_average",
+             &sweep_accumulator::set_average,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("average"),
+             py::arg("alpha"),
+             D(sweep_accumulator, set_average))
+
+
+        .def("set_threshold",
+             &sweep_accumulator::set_threshold,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("threshold"),
+             D(sweep_accumulator, set_threshold))
+
+
+        .def("set_interval",
+             &sweep_accumulator::set_interval,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("interval"),
+             D(sweep_accumulator, set_interval))
+
+
+        .def("set_reset_on_snapshot",
+             &sweep_accumulator::set_reset_on_snapshot,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("reset_on_snapshot"),
+             D(sweep_accumulator, set_reset_on_snapshot))
+
+
+        .def("reset",
+             &sweep_accumulator::reset,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sweep_accumulator, reset))
+
+
+        .def("sweeps",
+             &sweep_accumulator::sweeps,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sweep_accumulator, sweeps))
+
+        ;
+}
@@ -0,0 +1,57 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(sweep_delta_decoder.h)                                    */
+/* BINDTOOL_HEADER_FILE_HASH(13ab02e6eda8f4e13f099af46bed4a28)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/signal_hound/sweep_delta_decoder.h>
+// pydoc.h is automatically generated in the build directory
+#include <sweep_delta_decoder_pydoc.h>
+
+void bind_sweep_delta_decoder(py::module& m)
+{
+
+    using sweep_delta_decoder = ::gr::signal_hound::sweep_delta_decoder;
+
+
+    py::class_<sweep_delta_decoder,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<sweep_delta_decoder>>(m, "sweep_delta_decoder", D(sweep_delta_decoder))
+
+        .def(py::init(&sweep_delta_decoder::make),
+             D(sweep_delta_decoder, make))
+
+
+        .def("frames",
+             &sweep_delta_decoder::frames,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sweep_delta_decoder, frames))
+
+
+        .def("dropped",
+             &sweep_delta_decoder::dropped,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sweep_delta_decoder, dropped))
+
+        ;
+}
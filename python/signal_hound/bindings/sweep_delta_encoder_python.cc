@@ -0,0 +1,80 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(sweep_delta_encoder.h)                                    */
+/* BINDTOOL_HEADER_FILE_HASH(7d9c362d5b7ce484a466856ea2552702)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/signal_hound/sweep_delta_encoder.h>
+// pydoc.h is automatically generated in the build directory
+#include <sweep_delta_encoder_pydoc.h>
+
+void bind_sweep_delta_encoder(py::module& m)
+{
+
+    using sweep_delta_encoder = ::gr::signal_hound::sweep_delta_encoder;
+
+
+    py::class_<sweep_delta_encoder,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<sweep_delta_encoder>>(m, "sweep_delta_encoder", D(sweep_delta_encoder))
+
+        .def(py::init(&sweep_delta_encoder::make),
+             py::arg("threshold") = 0.5,
+             py::arg("key_interval") = 100,
+             py::arg("quantum") = 0.01,
+             D(sweep_delta_encoder, make))
+
+
+        .def("set_threshold",
+             &sweep_delta_encoder::set_threshold,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("threshold"),
+             D(sweep_delta_encoder, set_threshold))
+
+
+        .def("set_key_interval",
+             &sweep_delta_encoder::set_key_interval,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("key_interval"),
+             D(sweep_delta_encoder, set_key_interval))
+
+
+        .def("compression_ratio",
+             &sweep_delta_encoder::compression_ratio,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sweep_delta_encoder, compression_ratio))
+
+
+        .def("frames",
+             &sweep_delta_encoder::frames,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sweep_delta_encoder, frames))
+
+
+        .def("key_frames",
+             &sweep_delta_encoder::key_frames,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sweep_delta_encoder, key_frames))
+
+        ;
+}
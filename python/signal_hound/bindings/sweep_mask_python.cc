@@ -0,0 +1,93 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(sweep_mask.h)                                             */
+/* BINDTOOL_HEADER_FILE_HASH(ac8e0a7a0a94b9968109c2b0065e3f23)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/signal_hound/sweep_mask.h>
+// pydoc.h is automatically generated in the build directory
+#include <sweep_mask_pydoc.h>
+
+void bind_sweep_mask(py::module& m)
+{
+
+    using sweep_mask = ::gr::signal_hound::sweep_mask;
+
+
+    py::class_<sweep_mask,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<sweep_mask>>(m, "sweep_mask", D(sweep_mask))
+
+        .def(py::init(&sweep_mask::make),
+             py::arg("threshold") = -80.0,
+             py::arg("hysteresis") = 1.0,
+             py::arg("floor") = -100.0,
+             py::arg("excursion") = 6.0,
+             py::arg("max_peaks") = 10,
+             D(sweep_mask, make))
+
+
+        .def("set_threshold",
+             &sweep_mask::set_threshold,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("threshold"),
+             D(sweep_mask, set_threshold))
+
+
+        .def("set_mask",
+             &sweep_mask::set_mask,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("freqs"),
+             py::arg("levels"),
+             D(sweep_mask, set_mask))
+
+
+        .def("set_hysteresis",
+             &sweep_mask::set_hysteresis,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("hysteresis"),
+             D(sweep_mask, set_hysteresis))
+
+
+        .def("set_peaks",
+             &sweep_mask::set_peaks,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("floor"),
+             py::arg("excursion"),
+             py::arg("max_peaks"),
+             D(sweep_mask, set_peaks))
+
+
+        .def("sweeps",
+             &sweep_mask::sweeps,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sweep_mask, sweeps))
+
+
+        .def("violating_sweeps",
+             &sweep_mask::violating_sweeps,
+             py::call_guard<py::gil_scoped_release>(),
+             D(sweep_mask, violating_sweeps))
+
+        ;
+}
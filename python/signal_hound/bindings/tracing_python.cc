@@ -0,0 +1,52 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(tracing.h)                                                */
+/* BINDTOOL_HEADER_FILE_HASH(7a0a8e71a902729af11251b46be56d2a)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/signal_hound/tracing.h>
+// pydoc.h is automatically generated in the build directory
+#include <tracing_pydoc.h>
+
+void bind_tracing(py::module& m)
+{
+
+    py::module tracing = m.def_submodule("tracing");
+
+    tracing.def("enable",
+                &::gr::signal_hound::tracing::enable,
+                py::arg("on") = true,
+                D(tracing, enable));
+
+
+    tracing.def("enabled", &::gr::signal_hound::tracing::enabled, D(tracing, enabled));
+
+
+    tracing.def("clear", &::gr::signal_hound::tracing::clear, D(tracing, clear));
+
+
+    tracing.def("dump",
+                &::gr::signal_hound::tracing::dump,
+                py::arg("path"),
+                py::call_guard<py::gil_scoped_release>(),
+                D(tracing, dump));
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(vrt_source.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(3b10deee474a8b4337e291de81e14404)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/signal_hound/vrt_source.h>
+// pydoc.h is automatically generated in the build directory
+#include <vrt_source_pydoc.h>
+
+void bind_vrt_source(py::module& m)
+{
+
+    using vrt_source = ::gr::signal_hound::vrt_source;
+
+
+    py::class_<vrt_source,
+               gr::sync_block,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<vrt_source>>(m, "vrt_source", D(vrt_source))
+
+        .def(py::init(&vrt_source::make),
+             py::arg("address"),
+             py::arg("port"),
+             D(vrt_source, make))
+
+
+        .def("packets_lost",
+             &vrt_source::packets_lost,
+             py::call_guard<py::gil_scoped_release>(),
+             D(vrt_source, packets_lost))
+
+        ;
+}
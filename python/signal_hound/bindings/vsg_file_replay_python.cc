@@ -0,0 +1,73 @@
+/*
+ * Copyright 2025 Free Software Foundation, Inc.
+ *
+ * This file is part of GNU Radio
+ *
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ */
+
+/***********************************************************************************/
+/* This file is automatically generated using bindtool and can be manually edited  */
+/* The following lines can be configured to regenerate this file during cmake      */
+/* If manual edits are made, the following tags should be modified accordingly.    */
+/* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
+/* BINDTOOL_USE_PYGCCXML(0)                                                        */
+/* BINDTOOL_HEADER_FILE(vsg_file_replay.h)                                        */
+/* BINDTOOL_HEADER_FILE_HASH(3f39a9ab4b72369441fbaa6322d0fd43)                     */
+/***********************************************************************************/
+
+#include <pybind11/complex.h>
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+
+namespace py = pybind11;
+
+#include <gnuradio/signal_hound/vsg_file_replay.h>
+// pydoc.h is automatically generated in the build directory
+#include <vsg_file_replay_pydoc.h>
+
+void bind_vsg_file_replay(py::module& m)
+{
+
+    using vsg_file_replay = ::gr::signal_hound::vsg_file_replay;
+
+
+    py::class_<vsg_file_replay,
+               gr::block,
+               gr::basic_block,
+               std::shared_ptr<vsg_file_replay>>(m, "vsg_file_replay", D(vsg_file_replay))
+
+        .def(py::init(&vsg_file_replay::make),
+             py::arg("filename"),
+             py::arg("format") = "auto",
+             py::arg("center") = 1e9,
+             py::arg("samplerate") = 0.0,
+             py::arg("level") = -20.0,
+             py::arg("repeat") = true,
+             py::arg("start") = 0,
+             py::arg("count") = 0,
+             D(vsg_file_replay, make))
+
+
+        .def("set_center",
+             &vsg_file_replay::set_center,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("center"),
+             D(vsg_file_replay, set_center))
+
+
+        .def("set_level",
+             &vsg_file_replay::set_level,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("level"),
+             D(vsg_file_replay, set_level))
+
+
+        .def("samples_submitted",
+             &vsg_file_replay::samples_submitted,
+             py::call_guard<py::gil_scoped_release>(),
+             D(vsg_file_replay, samples_submitted))
+
+        ;
+}
@@ -14,7 +14,7 @@
 /* BINDTOOL_GEN_AUTOMATIC(0)                                                       */
 /* BINDTOOL_USE_PYGCCXML(0)                                                        */
 /* BINDTOOL_HEADER_FILE(vsg_series.h)                                        */
-/* BINDTOOL_HEADER_FILE_HASH(cac25b8444a6fc6137a731a29213e5cb)                     */
+/* BINDTOOL_HEADER_FILE_HASH(1e0bfe8fd5bcc829452c2e105177f91e)                     */
 /***********************************************************************************/
 
 #include <pybind11/complex.h>
@@ -45,37 +45,137 @@ void bind_vsg_series(py::module& m)
              py::arg("level"),
              py::arg("ioffset"),
              py::arg("qoffset"),
+             py::arg("idle_timeout") = 0.0,
              D(vsg_series, make))
 
 
         .def("set_center",
              &vsg_series::set_center,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("center"),
              D(vsg_series, set_center))
 
 
         .def("set_samplerate",
              &vsg_series::set_samplerate,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("samplerate"),
              D(vsg_series, set_samplerate))
 
 
         .def("set_level",
              &vsg_series::set_level,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("level"),
              D(vsg_series, set_level))
 
 
         .def("set_ioffset",
              &vsg_series::set_ioffset,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("ioffset"),
              D(vsg_series, set_ioffset))
 
 
         .def("set_qoffset",
              &vsg_series::set_qoffset,
+             py::call_guard<py::gil_scoped_release>(),
              py::arg("qoffset"),
              D(vsg_series, set_qoffset))
 
+
+        .def("set_idle_timeout",
+             &vsg_series::set_idle_timeout,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("seconds"),
+             D(vsg_series, set_idle_timeout))
+
+
+        .def("prewake",
+             &vsg_series::prewake,
+             py::call_guard<py::gil_scoped_release>(),
+             D(vsg_series, prewake))
+
+
+        .def("wake_latency",
+             &vsg_series::wake_latency,
+             py::call_guard<py::gil_scoped_release>(),
+             D(vsg_series, wake_latency))
+
+
+        .def("set_latency_markers",
+             &vsg_series::set_latency_markers,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("interval"),
+             py::arg("bandwidth") = 1e6,
+             py::arg("duration") = 1e-3,
+             D(vsg_series, set_latency_markers))
+
+
+        .def("set_hop_mode",
+             &vsg_series::set_hop_mode,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("enabled"),
+             py::arg("span") = 0.0,
+             D(vsg_series, set_hop_mode))
+
+
+        .def("set_hop_list",
+             &vsg_series::set_hop_list,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("frequencies"),
+             py::arg("dwell"),
+             D(vsg_series, set_hop_list))
+
+
+        .def("digital_hops",
+             &vsg_series::digital_hops,
+             py::call_guard<py::gil_scoped_release>(),
+             D(vsg_series, digital_hops))
+
+
+        .def("retunes",
+             &vsg_series::retunes,
+             py::call_guard<py::gil_scoped_release>(),
+             D(vsg_series, retunes))
+
+
+        .def("set_recal_policy",
+             &vsg_series::set_recal_policy,
+             py::call_guard<py::gil_scoped_release>(),
+             py::arg("drift"),
+             py::arg("idle_gap") = 0.05,
+             D(vsg_series, set_recal_policy))
+
+
+        .def("temperature",
+             &vsg_series::temperature,
+             py::call_guard<py::gil_scoped_release>(),
+             D(vsg_series, temperature))
+
+
+        .def("throughput",
+             &vsg_series::throughput,
+             py::call_guard<py::gil_scoped_release>(),
+             D(vsg_series, throughput))
+
+
+        .def("stalls",
+             &vsg_series::stalls,
+             py::call_guard<py::gil_scoped_release>(),
+             D(vsg_series, stalls))
+
+
+        .def("usb_errors",
+             &vsg_series::usb_errors,
+             py::call_guard<py::gil_scoped_release>(),
+             D(vsg_series, usb_errors))
+
+
+        .def("recals",
+             &vsg_series::recals,
+             py::call_guard<py::gil_scoped_release>(),
+             D(vsg_series, recals))
+
         ;
 }
@@ -0,0 +1,77 @@
+#
+# Copyright 2025 Signal Hound.
+#
+# SPDX-License-Identifier: GPL-3.0-or-later
+#
+
+'''
+Non-blocking access to block methods.
+
+The bindings release the GIL while a block method runs, so calling them from
+a worker thread keeps GUI and control threads responsive. call_async() runs
+a method on a small shared pool and returns a concurrent.futures.Future.
+
+Calls on the same block run one at a time in the order they were made, so
+two set_center() calls always leave the block on the second frequency.
+Calls on different blocks can run at the same time.
+
+    fut = signal_hound.call_async(src.set_center, 2.4e9)
+    fut.add_done_callback(lambda f: print("retuned"))
+'''
+
+import collections
+import threading
+from concurrent.futures import Future, ThreadPoolExecutor
+
+_executor = None
+_executor_lock = threading.Lock()
+
+# Calls waiting per block, keyed by id() while the block has any queued
+_queues = {}
+
+
+def _get_executor():
+    global _executor
+    with _executor_lock:
+        if _executor is None:
+            _executor = ThreadPoolExecutor(max_workers=4,
+                                           thread_name_prefix="signal_hound")
+        return _executor
+
+
+def _drain(key):
+    '''Run the calls queued for one block in order until none are left.'''
+    while True:
+        with _executor_lock:
+            queue = _queues[key]
+            if not queue:
+                del _queues[key]
+                return
+            future, method, args, kwargs = queue.popleft()
+
+        if not future.set_running_or_notify_cancel():
+            continue
+        try:
+            future.set_result(method(*args, **kwargs))
+        except BaseException as e:
+            future.set_exception(e)
+
+
+def call_async(method, *args, **kwargs):
+    '''
+    Run a block method (or any callable) on a worker thread.
+
+    Returns a concurrent.futures.Future holding the method's result.
+    '''
+    # The queued bound method keeps the block alive, so its id stays unique
+    key = id(getattr(method, '__self__', method))
+    future = Future()
+    with _executor_lock:
+        queue = _queues.get(key)
+        start = queue is None
+        if start:
+            queue = _queues[key] = collections.deque()
+        queue.append((future, method, args, kwargs))
+    if start:
+        _get_executor().submit(_drain, key)
+    return future